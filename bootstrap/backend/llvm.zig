@@ -3439,7 +3439,7 @@ pub fn codegen(unit: *Compilation.Unit, context: *const Compilation.Context) !vo
             .aggressively_optimize_for_size => .{ .speed_level = 2, .size_level = 2 }, // -Oz
         };
 
-        llvm.module.runOptimizationPipeline(target_machine, optimization_level);
+        llvm.module.runOptimizationPipeline(target_machine, optimization_level, false, false);
     }
     const file_path = unit.descriptor.executable_path;
     const object_file_path = blk: {
@@ -161,8 +161,15 @@ pub extern fn NativityLLVMLinkModules(destination: *LLVM.Module, source: *LLVM.M
 
 pub extern fn NativityLLVMGetTarget(target_triple_ptr: [*]const u8, target_triple_len: usize, message_ptr: *[*]const u8, message_len: *usize) ?*LLVM.Target;
 pub extern fn NativityLLVMTargetCreateTargetMachine(target: *LLVM.Target, target_triple_ptr: [*]const u8, target_triple_len: usize, cpu_ptr: [*]const u8, cpu_len: usize, features_ptr: [*]const u8, features_len: usize, relocation_model: LLVM.RelocationModel, maybe_code_model: LLVM.CodeModel, is_code_model_present: bool, optimization_level: LLVM.CodegenOptimizationLevel, jit: bool) *LLVM.Target.Machine;
-pub extern fn NativityLLVMRunOptimizationPipeline(module: *LLVM.Module, target_machine: *LLVM.Target.Machine, optimization_level: LLVM.OptimizationLevel) void;
+pub extern fn NativityLLVMRunOptimizationPipeline(module: *LLVM.Module, target_machine: *LLVM.Target.Machine, optimization_level: LLVM.OptimizationLevel, thin_lto: bool, lto: bool) void;
 pub extern fn NativityLLVMModuleAddPassesToEmitFile(module: *LLVM.Module, target_machine: *LLVM.Target.Machine, object_file_path_ptr: [*]const u8, object_file_path_len: usize, codegen_file_type: LLVM.CodeGenFileType, disable_verify: bool) bool;
+pub extern fn NativityLLVMModuleWriteThinLTOBitcode(module: *LLVM.Module, bitcode_file_path_ptr: [*]const u8, bitcode_file_path_len: usize) bool;
+pub extern fn NativityLLVMModuleGetBitcodeHash(module: *LLVM.Module, hash: *[32]u8) void;
+pub extern fn NativityLLVMModuleEmitToBuffer(module: *LLVM.Module, target_machine: *LLVM.Target.Machine, codegen_file_type: LLVM.CodeGenFileType, disable_verify: bool, buffer_ptr: *[*]const u8, buffer_len: *usize) bool;
+pub extern fn NativityLLVMArchiveWrite(archive_path_ptr: [*]const u8, archive_path_len: usize, member_path_ptrs: [*]const [*]const u8, member_path_lens: [*]const usize, member_buffer_ptrs: ?[*]const ?[*]const u8, member_buffer_lens: ?[*]const usize, member_count: usize, thread_count: c_uint, thin: bool, error_ptr: *[*]const u8, error_len: *usize) bool;
+pub extern fn NativityLLVMModuleSplit(module: *LLVM.Module, partition_count: c_uint, partitions: [*]*LLVM.Module) void;
+pub extern fn NativityLLVMModuleGetDefinedFunctionCount(module: *LLVM.Module) c_uint;
+pub extern fn NativityLLVMModuleDisposePartition(module: *LLVM.Module) void;
 pub extern fn NativityLLVMModuleSetTargetMachineDataLayout(module: *LLVM.Module, target_machine: *LLVM.Target.Machine) void;
 pub extern fn NativityLLVMModuleSetTargetTriple(module: *LLVM.Module, target_triple_ptr: [*]const u8, target_triple_len: usize) void;
 pub extern fn NativityLLVMTypeAssertEqual(a: *LLVM.Type, b: *LLVM.Type) void;
@@ -3,13 +3,15 @@ const configuration = @import("configuration");
 const std = @import("std");
 const builtin = @import("builtin");
 const library = @import("library.zig");
+const musl = @import("musl.zig");
 const assert = library.assert;
 const Arena = library.Arena;
 const PinnedArray = library.PinnedArray;
+const PinnedArrayWithPolicy = library.PinnedArrayWithPolicy;
 const PinnedHashMap = library.PinnedHashMap;
+const SmallVector = library.SmallVector;
 const byte_equal = library.byte_equal;
 const first_byte = library.first_byte;
-const hash_bytes = library.my_hash;
 const last_byte = library.last_byte;
 const starts_with_slice = library.starts_with_slice;
 const Atomic = std.atomic.Value;
@@ -42,16 +44,7 @@ fn fail_term(message: []const u8, term: []const u8) noreturn {
     fail();
 }
 
-fn is_space(ch: u8, next_ch: u8) bool {
-    const is_comment = ch == '/' and next_ch == '/';
-    const is_whitespace = ch == ' ';
-    const is_vertical_tab = ch == 0x0b;
-    const is_horizontal_tab = ch == '\t';
-    const is_line_feed = ch == '\n';
-    const is_carry_return = ch == '\r';
-    const result = ((is_vertical_tab or is_horizontal_tab) or (is_line_feed or is_carry_return)) or (is_comment or is_whitespace);
-    return result;
-}
+const is_space = library.is_space;
 
 pub fn write(string: []const u8) void {
     std.io.getStdOut().writeAll(string) catch unreachable;
@@ -203,52 +196,10 @@ const Parser = struct{
         return @intCast(parser.i - parser.column + 1);
     }
 
-    fn safe_flag(value: anytype, boolean: bool) @TypeOf(value) {
-        const result = value & (@as(@TypeOf(value), 0) -% @intFromBool(boolean));
-        return result;
-    }
-
-    fn get_next_ch_safe(file: []const u8, index: u64) u8 {
-        const next_index = index + 1;
-        const is_in_range = next_index < file.len;
-        const safe_index = safe_flag(next_index, is_in_range);
-        const unsafe_result = file[safe_index];
-        const safe_result = safe_flag(unsafe_result, is_in_range);
-        return safe_result;
-    }
+    const get_next_ch_safe = library.get_next_ch_safe;
 
     fn skip_space(parser: *Parser, file: []const u8) void {
-        const original_i = parser.i;
-
-        if (original_i == file.len or !is_space(file[original_i], get_next_ch_safe(file, original_i))) return;
-
-        while (parser.i < file.len) : (parser.i += 1) {
-            const ch = file[parser.i];
-            const new_line = ch == '\n';
-            parser.line += @intFromBool(new_line);
-
-            if (new_line) {
-                parser.column = @intCast(parser.i + 1);
-            }
-
-            if (!is_space(ch, get_next_ch_safe(file, parser.i))) {
-                return;
-            }
-
-            if (file[parser.i] == '/') {
-                parser.i += 2;
-
-                while (parser.i < file.len) : (parser.i += 1) {
-                    const is_line_feed = file[parser.i] == '\n';
-                    if (is_line_feed) {
-                        parser.line += 1;
-                        break;
-                    }
-                }
-
-                if (parser.i == file.len) break;
-            }
-        }
+        library.skip_space(parser, file);
     }
 
     const ParseFieldData = struct{
@@ -536,7 +487,7 @@ const Parser = struct{
 
         if (byte_equal(identifier, "_")) {
             return 0;
-        } else return intern_identifier(&thread.identifiers, identifier);
+        } else return intern_identifier(thread, identifier);
     }
 
     fn parse_non_escaped_string_literal(parser: *Parser, src: []const u8) []const u8 {
@@ -757,12 +708,11 @@ const Parser = struct{
                         fail();
                     }
 
-                    const hash = hash_bytes(std.mem.sliceAsBytes(instantiation_types.slice()));
-                    if (polymorphic_struct.instantiations.get(hash)) |instantiated_struct| {
+                    if (polymorphic_struct.instantiations.get(instantiation_types.const_slice())) |instantiated_struct| {
                         _ = instantiated_struct;
                         unreachable;
                     } else {
-                        const struct_polymorphic_name = thread.identifiers.get(polymorphic_struct.declaration.name).?;
+                        const struct_polymorphic_name = instance.identifiers.get_string(polymorphic_struct.declaration.name);
 
                         var struct_name = PinnedArray(u8){};
                         _ = struct_name.append_slice(struct_polymorphic_name);
@@ -776,7 +726,7 @@ const Parser = struct{
                         struct_name.length -= 2;
                         _ = struct_name.append(']');
 
-                        const struct_name_hash = intern_identifier(&thread.identifiers, struct_name.slice());
+                        const struct_name_hash = intern_identifier(thread, struct_name.slice());
 
                         const struct_type = thread.structs.append(.{
                             .type = .{
@@ -829,7 +779,7 @@ const Parser = struct{
                 else => |t| @panic(@tagName(t)),
             }
         } else {
-            fail_term("Unrecognized type expression", thread.identifiers.get(identifier).?);
+            fail_term("Unrecognized type expression", instance.identifiers.get_string(identifier));
         }
     }
 
@@ -1423,7 +1373,7 @@ const Parser = struct{
                 }
             }
 
-            const identifier: u32 = if (byte_equal(name, "_")) 0 else intern_identifier(&thread.identifiers, name);
+            const identifier: u32 = if (byte_equal(name, "_")) 0 else intern_identifier(thread, name);
 
             var initial_type: ?*Type = null;
             const initial_value = if (analyzer.current_scope.get_declaration(identifier)) |lookup_result| blk: {
@@ -1483,7 +1433,7 @@ const Parser = struct{
                                         });
                                         analyzer.append_instruction(&call.instruction);
 
-                                        _ = file.values_per_import.get(@enumFromInt(import_index)).append(&call.instruction.value);
+                                        _ = file.values_per_import.get(@intCast(import_index)).append(thread.arena, &call.instruction.value);
                                         return &call.instruction.value;
                                     },
                                     else => @panic((src.ptr + parser.i)[0..1]),
@@ -2751,9 +2701,9 @@ const Parser = struct{
 
                 if (!if_terminated) {
                     assert(if_jump_emission.jump.basic_block == not_taken_block);
-                    if_jump_emission.jump.basic_block.predecessors.length = 0;
-                    _ = if_jump_emission.jump.basic_block.predecessors.append(original_block);
-                    _ = new_exit_block.predecessors.append(if_jump_emission.jump.basic_block);
+                    if_jump_emission.jump.basic_block.predecessors.clear();
+                    _ = if_jump_emission.jump.basic_block.predecessors.append(thread.arena, original_block);
+                    _ = new_exit_block.predecessors.append(thread.arena, if_jump_emission.jump.basic_block);
                     if_jump_emission.jump.basic_block = new_exit_block;
                 }
 
@@ -2770,7 +2720,7 @@ const Parser = struct{
                 analyzer.current_basic_block = new_exit_block;
             }
         } else {
-            _ = exit_block.predecessors.append(original_block);
+            _ = exit_block.predecessors.append(thread.arena, original_block);
             analyzer.current_basic_block = exit_block;
         }
 
@@ -2850,8 +2800,7 @@ const LazyExpression = struct {
 };
 
 const Value = struct {
-    llvm: ?*LLVM.Value = null,
-    sema: struct {
+    sema: packed struct(u32) {
         thread: u16,
         resolved: bool,
         reserved: u7 = 0,
@@ -2891,6 +2840,16 @@ const Value = struct {
         .undefined = Undefined,
     });
 
+    // LLVM handles are kept in a side table of the thread lowering the node, not in the node, so that a node can be read by every
+    // thread that lowers it into its own module
+    fn get_llvm(value: *Value, thread: *Thread) ?*LLVM.Value {
+        return thread.llvm.values.get(value);
+    }
+
+    fn set_llvm(value: *Value, thread: *Thread, llvm: *LLVM.Value) void {
+        _ = thread.llvm.values.put(value, llvm);
+    }
+
     fn is_constant(value: *Value) bool {
         return switch (value.sema.id) {
             .constant_int,
@@ -2996,8 +2955,6 @@ const Value = struct {
 };
 
 const Type = struct {
-    llvm: ?*LLVM.Type = null,
-    llvm_debug: ?*LLVM.DebugInfo.Type = null,
     // TODO: ZIG BUG: if this is a packed struct, the initialization is broken
     sema: struct {
         thread: u16,
@@ -3114,7 +3071,7 @@ const Type = struct {
         scope: Scope,
         parameters: []const *Type,
         fields: []const *PolymorphicField,
-        instantiations: PinnedHashMap(u32, *Type.Struct) = .{},
+        instantiations: PinnedHashMap([]const *Type, *Type.Struct) = .{},
     };
 
     const id_to_type_map = std.EnumArray(Id, type).init(.{
@@ -3139,6 +3096,23 @@ const Type = struct {
         return @fieldParentPtr("type", ty);
     }
 
+    // See Value.get_llvm
+    fn get_llvm(ty: *Type, thread: *Thread) ?*LLVM.Type {
+        return thread.llvm.types.get(ty);
+    }
+
+    fn set_llvm(ty: *Type, thread: *Thread, llvm: *LLVM.Type) void {
+        _ = thread.llvm.types.put(ty, llvm);
+    }
+
+    fn get_llvm_debug(ty: *Type, thread: *Thread) ?*LLVM.DebugInfo.Type {
+        return thread.llvm.debug_types.get(ty);
+    }
+
+    fn set_llvm_debug(ty: *Type, thread: *Thread, llvm_debug: *LLVM.DebugInfo.Type) void {
+        _ = thread.llvm.debug_types.put(ty, llvm_debug);
+    }
+
     fn clone(ty: *Type, args: struct{
         destination_thread: *Thread,
         source_thread_index: u16,
@@ -3216,7 +3190,6 @@ const Type = struct {
                 else => |t| @panic(@tagName(t)),
             };
 
-            result.llvm = null;
             result.sema.thread = args.destination_thread.get_index();
 
             _ = args.destination_thread.cloned_types.put_no_clobber(ty, result);
@@ -3224,7 +3197,6 @@ const Type = struct {
             break :blk result;
         };
 
-        assert(result.llvm == null);
         assert(result.sema.thread == args.destination_thread.get_index());
         return result;
     }
@@ -3348,12 +3320,20 @@ fn parse_keyword(identifier: []const u8) u32 {
 const Scope = struct {
     declarations: PinnedHashMap(u32, *Declaration) = .{},
     parent: ?*Scope,
-    llvm: ?*LLVM.DebugInfo.Scope = null,
     line: u32,
     column: u32,
     file: u32,
     id: Id,
 
+    // See Value.get_llvm
+    fn get_llvm(scope: *Scope, thread: *Thread) ?*LLVM.DebugInfo.Scope {
+        return thread.llvm.scopes.get(scope);
+    }
+
+    fn set_llvm(scope: *Scope, thread: *Thread, llvm: *LLVM.DebugInfo.Scope) void {
+        _ = thread.llvm.scopes.put(scope, llvm);
+    }
+
     pub fn get_global_declaration(scope: *Scope, name: u32) ?*GlobalDeclaration {
         assert(scope.id == .file);
         if (scope.get_declaration_one_level(name)) |decl_ref| {
@@ -3469,8 +3449,8 @@ const GlobalDeclaration = struct {
 
 const BasicBlock = struct{
     value: Value,
-    instructions: PinnedArray(*Instruction) = .{},
-    predecessors: PinnedArray(*BasicBlock) = .{},
+    instructions: SmallVector(*Instruction, 4) = .{},
+    predecessors: SmallVector(*BasicBlock, 2) = .{},
     is_terminated: bool = false,
     command_node: CommandList.Node = .{
         .data = {},
@@ -3480,8 +3460,8 @@ const BasicBlock = struct{
 
     const CommandList = std.DoublyLinkedList(void);
 
-    pub fn get_llvm(basic_block: *BasicBlock) *LLVM.Value.BasicBlock{
-        return basic_block.value.llvm.?.toBasicBlock() orelse unreachable; 
+    pub fn get_llvm(basic_block: *BasicBlock, thread: *Thread) *LLVM.Value.BasicBlock{
+        return basic_block.value.get_llvm(thread).?.toBasicBlock() orelse unreachable;
     }
 };
 
@@ -3523,9 +3503,9 @@ const Declaration = struct {
 const Function = struct{
     declaration: Function.Declaration,
     entry_block: *BasicBlock,
-    stack_slots: PinnedArray(*LocalSymbol) = .{},
+    stack_slots: SmallVector(*LocalSymbol, 4) = .{},
     scope: Function.Scope,
-    arguments: PinnedArray(*ArgumentSymbol) = .{},
+    arguments: SmallVector(*ArgumentSymbol, 4) = .{},
 
     const Attributes = struct{
     };
@@ -3634,7 +3614,6 @@ const Function = struct{
             result.global_symbol.attributes.@"export" = false;
             result.global_symbol.attributes.@"extern" = true;
             result.global_symbol.value.sema.thread = destination_thread.get_index();
-            result.global_symbol.value.llvm = null;
             return result;
         }
     };
@@ -3679,15 +3658,16 @@ const ConstantBitfield = struct{
     type: *Type,
 };
 
+// Kept small on purpose: the source location lives in the thread's `debug_locations` side table and is referenced by index, and
+// the LLVM handle in the lowering thread's side table (see Value.get_llvm), so an instruction header is 16 bytes instead of 48.
+// Only the header shrank: instructions are still pointer-linked records whose payloads live in per-kind arrays
 const Instruction = struct{
     value: Value,
-    basic_block: ?*BasicBlock = null,
-    scope: *Scope,
-    line: u32,
-    column: u32,
+    debug_location: u32,
     id: Id,
+    is_appended: bool = false,
 
-    const Id = enum{
+    const Id = enum(u8){
         abi_argument,
         abi_indirect_argument,
         argument_storage,
@@ -3747,6 +3727,16 @@ const Instruction = struct{
         assert(instruction.id == id);
         return @fieldParentPtr("instruction", instruction);
     }
+
+    comptime {
+        assert(@sizeOf(Instruction) <= 16);
+    }
+};
+
+const DebugLocation = struct{
+    scope: *Scope,
+    line: u32,
+    column: u32,
 };
 
 const AbiArgument = struct{
@@ -4106,14 +4096,15 @@ const integer_name_map = [128][]const u8{
 
 const Thread = struct{
     arena: *Arena = undefined,
-    functions: PinnedArray(Function) = .{},
+    functions: PinnedArrayWithPolicy(Function, library.large_commit_policy) = .{},
     external_functions: PinnedArray(Function.Declaration) = .{},
-    identifiers: PinnedHashMap(u32, []const u8) = .{},
+    // Thread-local front of `instance.identifiers`, so only the first sighting of a string takes the lock
+    identifier_cache: library.StringMap = .{},
     constant_ints: PinnedArray(ConstantInt) = .{},
     constant_arrays: PinnedArray(ConstantArray) = .{},
     constant_structs: PinnedArray(ConstantStruct) = .{},
     constant_bitfields: PinnedArray(ConstantBitfield) = .{},
-    basic_blocks: PinnedArray(BasicBlock) = .{},
+    basic_blocks: PinnedArrayWithPolicy(BasicBlock, library.large_commit_policy) = .{},
     task_system: TaskSystem = .{},
     debug_info_file_map: PinnedHashMap(u32, LLVMFile) = .{},
     branches: PinnedArray(Branch) = .{},
@@ -4144,6 +4135,7 @@ const Thread = struct{
     extract_values: PinnedArray(ExtractValue) = .{},
     debug_arguments: PinnedArray(DebugArgument) = .{},
     debug_locals: PinnedArray(DebugLocal) = .{},
+    debug_locations: PinnedArray(DebugLocation) = .{},
     function_types: PinnedArray(Type.Function) = .{},
     array_type_map: PinnedHashMap(Type.Array.Descriptor, *Type) = .{},
     typed_pointer_type_map: PinnedHashMap(Type.TypedPointer.Descriptor, *Type) = .{},
@@ -4158,22 +4150,47 @@ const Thread = struct{
     polymorphic_fields: PinnedArray(Type.PolymorphicField) = .{},
     bitfields: PinnedArray(Type.Bitfield) = .{},
     cloned_types: PinnedHashMap(*Type, *Type) = .{},
+    // This thread's copies of functions defined by other threads, keyed by the definition in the owning thread
+    imported_declarations: PinnedHashMap(*Function.Declaration, *Function.Declaration) = .{},
+    imported_declaration_reuse_count: u32 = 0,
     polymorphic_names: PinnedArray(Type.PolymorphicName) = .{},
     constant_strings: PinnedHashMap(u32, String) = .{},
     global_strings: PinnedHashMap(u32, String) = .{},
     string_buffer: PinnedArray(u8) = .{},
     analyzed_file_count: u32 = 0,
     assigned_file_count: u32 = 0,
+    analysis_notified: bool = false,
+    object_cache_lookups: u32 = 0,
+    object_cache_hits: u32 = 0,
+    c_object_lookups: u32 = 0,
+    c_object_reuses: u32 = 0,
+    // Shared queue the job being executed was taken from, null if it came from the thread-bound queue
+    current_job_queue: ?*SharedJobQueue = null,
+    steal_count: u32 = 0,
+    emitted_partition_count: u32 = 0,
     llvm: struct {
         context: *LLVM.Context,
         module: *LLVM.Module,
         attributes: LLVM.Attributes,
+        target: *LLVM.Target,
         target_machine: *LLVM.Target.Machine,
-        object: ?[]const u8 = null,
+        target_triple: []const u8,
+        cpu: []const u8,
+        features: []const u8,
+        codegen_optimization_level: LLVM.CodegenOptimizationLevel,
+        objects: LLVMObjects = .{},
+        // Only used when the module was split by function
+        partitions: []LLVMPartition = &.{},
+        pending_partitions: u32 = 0,
         intrinsic_ids: std.EnumArray(LLVMIntrinsic, LLVM.Value.IntrinsicID),
         fixed_intrinsic_functions: std.EnumArray(LLVMFixedIntrinsic, *LLVM.Value.Constant.Function),
         intrinsic_id_map: PinnedHashMap([]const u8, LLVM.Value.IntrinsicID) = .{},
         intrinsic_function_map: PinnedHashMap(LLVMIntrinsic.Parameters, *LLVM.Value.Constant.Function) = .{},
+        // Handles of the IR nodes lowered into this thread's module (see Value.get_llvm)
+        values: PinnedHashMap(*Value, *LLVM.Value) = .{},
+        types: PinnedHashMap(*Type, *LLVM.Type) = .{},
+        debug_types: PinnedHashMap(*Type, *LLVM.DebugInfo.Type) = .{},
+        scopes: PinnedHashMap(*Scope, *LLVM.DebugInfo.Scope) = .{},
         pointer: *LLVM.Type,
         slice: *LLVM.Type,
     } = undefined,
@@ -4234,6 +4251,7 @@ const Thread = struct{
     handle: std.Thread = undefined,
     generate_debug_information: bool = true,
     time: if (configuration.timers) Time else void = if (configuration.timers) .{} else {},
+    stage_spans: if (configuration.timers) PinnedArray(StageSpan) else void = if (configuration.timers) .{} else {},
     const Timers = std.EnumArray(Timer, TimeRange);
     const Time = struct{
         timestamp: Instant = std.mem.zeroes(Instant),
@@ -4244,28 +4262,147 @@ const Thread = struct{
         setup,
         analysis,
         llvm_build_ir,
+        llvm_optimize,
+        llvm_emit_object,
+    };
+
+    // What a worker was busy with and when, so the overlap between analysis and codegen across threads can be inspected
+    const Stage = enum{
+        analysis,
+        llvm_build_ir,
+        llvm_optimize,
         llvm_emit_object,
+        c_compile,
+
+        fn from_job(id: Job.Id) Stage {
+            return switch (id) {
+                .analyze_file, .notify_file_resolved => .analysis,
+                .llvm_generate_ir => .llvm_build_ir,
+                .llvm_optimize => .llvm_optimize,
+                .llvm_emit_object, .llvm_emit_partition => .llvm_emit_object,
+                .compile_c_source_file, .compile_c_source_batch, .compile_c_source_batch_file => .c_compile,
+                else => unreachable,
+            };
+        }
+    };
+
+    const StageSpan = struct{
+        stage: Stage,
+        start: Instant,
+        end: Instant,
     };
 
     fn add_thread_work(thread: *Thread, job: Job) void {
         @atomicStore(@TypeOf(thread.task_system.state), &thread.task_system.state, .running, .seq_cst);
         assert(@atomicLoad(@TypeOf(thread.task_system.program_state), &thread.task_system.program_state, .seq_cst) != .none);
         thread.task_system.job.queue_job(job);
+        signal_wake(&instance.worker_signal);
+    }
+
+    // Jobs queued here can be taken by any idle thread
+    fn add_shared_work(thread: *Thread, job: Job) void {
+        @atomicStore(@TypeOf(thread.task_system.state), &thread.task_system.state, .running, .seq_cst);
+        assert(@atomicLoad(@TypeOf(thread.task_system.program_state), &thread.task_system.program_state, .seq_cst) != .none);
+        thread.task_system.shared.queue_job(job);
+        signal_wake(&instance.worker_signal);
+    }
+
+    // Jobs queued here can be taken by any idle thread too. Must only be called by the thread itself
+    fn add_owned_work(thread: *Thread, job: Job) void {
+        thread.task_system.owned.queue_job(job);
+        signal_wake(&instance.worker_signal);
     }
 
     fn add_control_work(thread: *Thread, job: Job) void {
         thread.task_system.ask.queue_job(job);
+        signal_wake(&instance.control_signal);
     }
 
     fn get_worker_job(thread: *Thread) ?Job {
         if (thread.task_system.job.get_next_job()) |job| {
             // std.debug.print("[WORKER] Thread #{} getting job {s}\n", .{thread.get_index(), @tagName(job.id)});
+            thread.current_job_queue = null;
+            return job;
+        }
+
+        // The owner is held to the same rules as thieves: a file it is waiting on, or any file once it left analysis, is not its to take
+        if (thread.task_system.shared.take_job(thread)) |job| {
+            thread.current_job_queue = &thread.task_system.shared;
+            return job;
+        }
+
+        if (thread.task_system.owned.take_job(thread)) |job| {
+            thread.current_job_queue = &thread.task_system.owned;
             return job;
         }
 
+        return thread.steal_job();
+    }
+
+    fn steal_job(thread: *Thread) ?Job {
+        const thread_index = thread.get_index();
+        for (1..instance.threads.len) |offset| {
+            const victim = &instance.threads[(thread_index + offset) % instance.threads.len];
+            for ([_]*SharedJobQueue{ &victim.task_system.shared, &victim.task_system.owned }) |job_queue| {
+                if (job_queue.take_job(thread)) |job| {
+                    // std.debug.print("[WORKER] Thread #{} stealing job {s} from thread #{}\n", .{thread_index, @tagName(job.id), victim.get_index()});
+                    thread.current_job_queue = job_queue;
+                    thread.steal_count += 1;
+                    return job;
+                }
+            }
+        }
+
         return null;
     }
 
+    // Checked by every consumer of a shared queue, its owner included
+    fn can_take(thread: *Thread, job: Job) bool {
+        return switch (job.id) {
+            // Once the thread told the control thread its analysis is done it moves on to LLVM, so it can't take more files.
+            // A file whose resolution this thread is waiting on must be analyzed by another thread
+            .analyze_file => b: {
+                if (thread.analysis_notified) break :b false;
+
+                const file = instance.files.get_unchecked(job.offset);
+                for (file.interested_threads.slice()) |interested_thread| {
+                    if (interested_thread == thread.get_index()) break :b false;
+                }
+
+                break :b true;
+            },
+            .compile_c_source_file, .compile_c_source_batch, .compile_c_source_batch_file => true,
+            // Partitions live in their own LLVM context, so any thread can optimize and emit them
+            .llvm_emit_partition => true,
+            else => false,
+        };
+    }
+
+    fn complete_worker_job(thread: *Thread) void {
+        if (thread.current_job_queue) |job_queue| {
+            job_queue.complete_job();
+        } else {
+            thread.task_system.job.complete_job();
+        }
+
+        // The control thread decides when the unit is done by looking at the completed counters
+        signal_wake(&instance.control_signal);
+    }
+
+    // If the thread has analyzed the same files it has been assigned and it has nothing else to do, tell the control thread
+    // that the thread has finished file analysis so it can proceed to the next step
+    fn try_notify_analysis_complete(thread: *Thread) void {
+        if (!thread.analysis_notified and thread.assigned_file_count > 0 and thread.analyzed_file_count == thread.assigned_file_count and AnalysisState.try_leave()) {
+            @atomicStore(bool, &thread.analysis_notified, true, .release);
+            if (configuration.timers) {
+                thread.time.timers.getPtr(.analysis).end = get_instant();
+            }
+            thread.add_control_work(.{
+                .id = .notify_analysis_complete,
+            });
+        }
+    }
+
     fn get_control_job(thread: *Thread) ?Job {
         if (thread.task_system.ask.get_next_job()) |job| {
             // std.debug.print("[CONTROL] Getting job {s} from thread #{}\n", .{@tagName(job.id), thread.get_index()});
@@ -4279,6 +4416,23 @@ const Thread = struct{
         const index = @divExact(@intFromPtr(thread) - @intFromPtr(instance.threads.ptr), @sizeOf(Thread));
         return @intCast(index);
     }
+
+    // Instructions are created statement by statement, so checking the last entry deduplicates most locations
+    fn get_debug_location(thread: *Thread, scope: *Scope, line: u32, column: u32) u32 {
+        const length = thread.debug_locations.length;
+        if (length > 0) {
+            const last = thread.debug_locations.get_unchecked(length - 1);
+            if (last.scope == scope and last.line == line and last.column == column) {
+                return length - 1;
+            }
+        }
+
+        return thread.debug_locations.append_index(.{
+            .scope = scope,
+            .line = line,
+            .column = column,
+        });
+    }
 };
 
 const LLVMFixedIntrinsic = enum{
@@ -4294,6 +4448,34 @@ const LLVMIntrinsic = enum{
     };
 };
 
+const LLVMPartition = struct {
+    module: *LLVM.Module,
+    objects: LLVMObjects = .{},
+    // Split off a module that already went through the optimization pipeline, so only machine code is left to emit
+    optimized: bool,
+};
+
+// Objects emitted for a module: paths of objects on disk and objects that only live in memory
+const LLVMObjects = struct {
+    paths: []const []const u8 = &.{},
+    buffers: []const []const u8 = &.{},
+
+    fn count(objects: LLVMObjects) usize {
+        return objects.paths.len + objects.buffers.len;
+    }
+
+    // A module's objects are either all on disk or all in memory, so this keeps them in the order they were emitted
+    fn append_to(objects: LLVMObjects, link_objects: *PinnedArray(LinkObject)) void {
+        for (objects.paths) |path| {
+            _ = link_objects.append(.{ .path = path });
+        }
+
+        for (objects.buffers) |buffer| {
+            _ = link_objects.append(.{ .buffer = buffer });
+        }
+    }
+};
+
 const LLVMFile = struct {
     file: *LLVM.DebugInfo.File,
     compile_unit: *LLVM.DebugInfo.CompileUnit,
@@ -4312,15 +4494,74 @@ const Job = packed struct(u64) {
         llvm_generate_ir,
         llvm_notify_ir_done,
         llvm_optimize,
+        llvm_notify_optimize_done,
         llvm_emit_object,
         llvm_notify_object_done,
+        llvm_emit_partition,
+        llvm_notify_partitioned,
         compile_c_source_file,
+        compile_c_source_batch,
+        compile_c_source_batch_file,
     };
 };
 
+// Shared bookkeeping of the analysis phase. A file can only be analyzed by a thread that is still analyzing and is not the one waiting
+// on it, so a thread only leaves analysis if that can't strand a file. Both counts live in one word so that checking them and leaving
+// is a single atomic step
+const AnalysisState = packed struct(u64){
+    // Threads that can still take files
+    eligible_thread_count: u32,
+    // Files requested or assigned but not analyzed yet. Only threads with unfinished files request new ones
+    unfinished_file_count: u32,
+
+    const unfinished_file_unit: u64 = @as(u64, 1) << @bitOffsetOf(AnalysisState, "unfinished_file_count");
+
+    fn init(thread_count: u32) void {
+        assert(thread_count >= 2);
+        const state = AnalysisState{
+            .eligible_thread_count = thread_count,
+            .unfinished_file_count = 0,
+        };
+        @atomicStore(u64, &instance.analysis_state, @bitCast(state), .release);
+    }
+
+    fn add_unfinished_file() void {
+        _ = @atomicRmw(u64, &instance.analysis_state, .Add, unfinished_file_unit, .acq_rel);
+    }
+
+    fn finish_file() void {
+        const previous: AnalysisState = @bitCast(@atomicRmw(u64, &instance.analysis_state, .Sub, unfinished_file_unit, .acq_rel));
+        if (previous.unfinished_file_count == 1) {
+            // Threads that were held back can leave now
+            signal_wake(&instance.worker_signal);
+        }
+    }
+
+    fn try_leave() bool {
+        var word = @atomicLoad(u64, &instance.analysis_state, .acquire);
+        while (true) {
+            const state: AnalysisState = @bitCast(word);
+            // An unfinished file may still request an import, which needs a taker besides the requesting thread
+            if (state.unfinished_file_count != 0 and state.eligible_thread_count <= 2) {
+                return false;
+            }
+
+            const new_state = AnalysisState{
+                .eligible_thread_count = state.eligible_thread_count - 1,
+                .unfinished_file_count = state.unfinished_file_count,
+            };
+            word = @cmpxchgWeak(u64, &instance.analysis_state, word, @bitCast(new_state), .acq_rel, .acquire) orelse return true;
+        }
+    }
+};
+
 const TaskSystem = struct{
     job: JobQueue = .{},
     ask: JobQueue = .{},
+    shared: SharedJobQueue = .{},
+    // Partitions of this thread's module and the files of a C batch it set up. Filled by the thread itself, so it can't share a queue
+    // with the control thread
+    owned: SharedJobQueue = .{},
     program_state: ProgramState = .none,
     state: ThreadState = .idle,
 
@@ -4331,6 +4572,7 @@ const TaskSystem = struct{
         analysis,
         llvm_generate_ir,
         llvm_emit_object,
+        llvm_emit_partitions,
         llvm_finished_object,
     };
 
@@ -4365,9 +4607,9 @@ const JobQueue = struct{
         // std.debug.print("[0x{x}] Queueing job '{s}'\n", .{@intFromPtr(job_queue) & 0xfff, @tagName(job.id)});
         const index = job_queue.queuer.next_write;
         if (weak_memory_model) @fence(.seq_cst);
-        assert(index + 1 != @atomicLoad(@TypeOf(job_queue.worker.next_read), &job_queue.worker.next_read, .seq_cst));
+        assert(index - @atomicLoad(@TypeOf(job_queue.worker.next_read), &job_queue.worker.next_read, .seq_cst) < job_entry_count);
         if (weak_memory_model)         @fence(.seq_cst);
-        const ptr = &job_queue.entries[index];
+        const ptr = &job_queue.entries[index % job_entry_count];
         //if (job.id == .analyze_file and job.count == 0 and job.offset == 0) unreachable;
         // std.debug.print("Before W 0x{x} - 0x{x}\n", .{@intFromPtr(ptr), job.offset});
         ptr.* = job;
@@ -4388,7 +4630,7 @@ const JobQueue = struct{
             if (weak_memory_model) @fence(.seq_cst);
             job_queue.worker.next_read += 1;
             if (weak_memory_model) @fence(.seq_cst);
-            const job_ptr = &job_queue.entries[index];
+            const job_ptr = &job_queue.entries[index % job_entry_count];
             if (weak_memory_model) @fence(.seq_cst);
             const job = job_ptr.*;
             if (weak_memory_model) @fence(.seq_cst);
@@ -4405,13 +4647,75 @@ const JobQueue = struct{
     }
 };
 
+// Single producer (the control thread for `shared`, the owner thread for `partition`), multiple consumers (the owner thread and thieves).
+// Entries are never reused, so the queue is not bounded by a ring size
+const SharedJobQueue = struct{
+    entries: PinnedArray(Job) = .{},
+    // Set by whoever takes the entry. A consumer skips the jobs it can't take, so entries are not necessarily taken in order
+    taken: PinnedArray(bool) = .{},
+    next_write: u64 align(cache_line_size) = 0,
+    // Every entry before this one is taken
+    next_read: u64 align(cache_line_size) = 0,
+    completed: u64 align(cache_line_size) = 0,
+
+    fn queue_job(job_queue: *SharedJobQueue, job: Job) void {
+        _ = job_queue.entries.append(job);
+        _ = job_queue.taken.append(false);
+        @atomicStore(u64, &job_queue.next_write, job_queue.entries.length, .seq_cst);
+    }
+
+    fn take_job(job_queue: *SharedJobQueue, taker: *Thread) ?Job {
+        const next_write = @atomicLoad(u64, &job_queue.next_write, .seq_cst);
+        var index = @atomicLoad(u64, &job_queue.next_read, .seq_cst);
+
+        while (index < next_write) : (index += 1) {
+            if (@atomicLoad(bool, &job_queue.taken.pointer[index], .seq_cst)) continue;
+
+            const job = job_queue.entries.pointer[index];
+            if (!taker.can_take(job)) continue;
+
+            if (@cmpxchgStrong(bool, &job_queue.taken.pointer[index], false, true, .seq_cst, .seq_cst) == null) {
+                job_queue.advance_read(next_write);
+                return job;
+            }
+        }
+
+        return null;
+    }
+
+    fn advance_read(job_queue: *SharedJobQueue, next_write: u64) void {
+        var index = @atomicLoad(u64, &job_queue.next_read, .seq_cst);
+        while (index < next_write and @atomicLoad(bool, &job_queue.taken.pointer[index], .seq_cst)) {
+            index = @cmpxchgWeak(u64, &job_queue.next_read, index, index + 1, .seq_cst, .seq_cst) orelse index + 1;
+        }
+    }
+
+    fn complete_job(job_queue: *SharedJobQueue) void {
+        _ = @atomicRmw(u64, &job_queue.completed, .Add, 1, .seq_cst);
+    }
+};
+
 const Instance = struct{
     files: PinnedArray(File) = .{},
+    // Interned path of every file, indexed like `files`
     file_paths: PinnedArray(u32) = .{},
+    identifiers: library.Interner = .{},
+    // Sources read ahead of time by a compiler server. Requests are forked from the server, so they inherit these without reading them again
+    resident_sources: library.StringMap = .{},
+    resident_source_files: PinnedArray(ResidentSource) = .{},
+    // Link inputs (crt objects, libc and what its linker scripts name) a compiler server loaded into anonymous in-memory files. Forked
+    // requests inherit the descriptors and hand LLD their /proc/self/fd paths instead of walking the search paths and reading the disk.
+    // Only the bytes are resident: LLD still parses every input on every link
+    resident_link_inputs: library.StringMap = .{},
+    resident_link_input_files: PinnedArray(ResidentLinkInput) = .{},
     file_mutex: std.Thread.Mutex = .{},
     units: PinnedArray(Unit) = .{},
     arena: *Arena = undefined,
     threads: []Thread = undefined,
+    // Futex words: bumped every time there is something new for the workers or the control thread to look at
+    worker_signal: std.atomic.Value(u32) align(cache_line_size) = std.atomic.Value(u32).init(0),
+    analysis_state: u64 align(cache_line_size) = 0,
+    control_signal: std.atomic.Value(u32) align(cache_line_size) = std.atomic.Value(u32).init(0),
     paths: struct {
         cwd: []const u8,
         executable: []const u8,
@@ -4431,6 +4735,236 @@ const Instance = struct{
     }
 };
 
+const ResidentSource = struct{
+    bytes: []const u8,
+    size: u64,
+    modification_time: i128,
+};
+
+fn add_resident_sources(directory_path: []const u8) void {
+    var directory = std.fs.cwd().openDir(directory_path, .{ .iterate = true }) catch fail_term("Unable to open directory to preload", directory_path);
+    defer directory.close();
+
+    var walker = directory.walk(std.heap.page_allocator) catch unreachable;
+    defer walker.deinit();
+
+    while (walker.next() catch unreachable) |entry| {
+        if (entry.kind == .file and library.ends_with_slice(entry.basename, ".nat")) {
+            const relative_path = instance.arena.join(&.{ directory_path, "/", entry.path }) catch unreachable;
+            const absolute_path = library.realpath(instance.arena, std.fs.cwd(), relative_path) catch unreachable;
+            const file = std.fs.cwd().openFile(absolute_path, .{}) catch unreachable;
+            defer file.close();
+            const stat = file.stat() catch unreachable;
+            const bytes = instance.arena.new_array(u8, stat.size) catch unreachable;
+            const read_byte_count = file.readAll(bytes) catch unreachable;
+            assert(read_byte_count == stat.size);
+
+            const index = instance.resident_source_files.length;
+            _ = instance.resident_source_files.append(.{
+                .bytes = bytes,
+                .size = stat.size,
+                .modification_time = stat.mtime,
+            });
+            _ = instance.resident_sources.put(absolute_path, index);
+            intern_source_identifiers(bytes);
+        }
+    }
+}
+
+// Identifiers are interned into the shared table ahead of time, so a request forked from the server finds the names of every
+// preloaded file already there and only fills its per-thread caches. Comments and string literals are skipped
+fn intern_source_identifiers(source: []const u8) void {
+    var i: usize = 0;
+    while (i < source.len) {
+        const ch = source[i];
+        if (ch == '/' and i + 1 < source.len and source[i + 1] == '/') {
+            i = std.mem.indexOfScalarPos(u8, source, i, '\n') orelse source.len;
+        } else if (ch == '"' or ch == '\'') {
+            i = std.mem.indexOfScalarPos(u8, source, i + 1, ch) orelse source.len;
+            i += 1;
+        } else if (std.ascii.isAlphabetic(ch) or ch == '_') {
+            const start = i;
+            while (i < source.len and (std.ascii.isAlphanumeric(source[i]) or source[i] == '_')) {
+                i += 1;
+            }
+
+            _ = instance.identifiers.intern(source[start..i]);
+        } else {
+            i += 1;
+        }
+    }
+}
+
+// A preloaded source can only be used if the file didn't change since the server read it
+fn get_resident_source(file_absolute_path: []const u8) ?library.MappedFile {
+    const index = instance.resident_sources.get(file_absolute_path) orelse return null;
+    const resident_source = &instance.resident_source_files.pointer[index];
+    const stat = std.fs.cwd().statFile(file_absolute_path) catch return null;
+    if (stat.size != resident_source.size or stat.mtime != resident_source.modification_time) return null;
+
+    return .{
+        .bytes = resident_source.bytes,
+        .is_mapped = false,
+    };
+}
+
+const ResidentLinkInput = struct{
+    // Where the input was loaded from
+    source_path: []const u8,
+    path: []const u8,
+    size: u64,
+    modification_time: i128,
+    // Resident inputs a linker script was rewritten to point at
+    named_inputs: []const u32,
+};
+
+fn add_resident_link_inputs() void {
+    const arguments = get_link_arguments(.{
+        .output_file_path = "",
+        .extra_arguments = &.{},
+        .objects = &.{},
+        .libraries = &.{},
+        .link_libc = true,
+        .link_libcpp = true,
+    });
+
+    for (arguments.inputs.const_slice()) |argument_index| {
+        if (arguments.resolve_input(arguments.argv.pointer[argument_index])) |path| {
+            _ = add_resident_link_input(path);
+        }
+    }
+}
+
+fn add_resident_link_input(path: []const u8) ?u32 {
+    if (instance.resident_link_inputs.get(path)) |index| {
+        return index;
+    }
+
+    const file = std.fs.cwd().openFile(path, .{}) catch return null;
+    defer file.close();
+    const stat = file.stat() catch return null;
+    var bytes: []const u8 = file.readToEndAlloc(std.heap.page_allocator, std.math.maxInt(u32)) catch return null;
+    var named_inputs: []const u32 = &.{};
+
+    // The files a linker script names are made resident too and the script is rewritten to point at them. LLD looks up relative
+    // names next to the script, which a /proc/self/fd path has none of, so a script naming any is left on disk
+    if (LinkerScriptTokenizer.is_script(bytes)) {
+        var pieces = std.BoundedArray([]const u8, 64){};
+        var indices = std.BoundedArray(u32, 32){};
+        var tokenizer = LinkerScriptTokenizer{ .bytes = bytes };
+        var copied_byte_count: usize = 0;
+
+        while (tokenizer.next()) |token| {
+            if (library.starts_with_slice(token, "-l")) continue;
+            if (token[0] != '/') return null;
+
+            const index = add_resident_link_input(token) orelse return null;
+            const token_offset = tokenizer.index - token.len;
+            pieces.append(bytes[copied_byte_count..token_offset]) catch return null;
+            pieces.append(instance.resident_link_input_files.pointer[index].path) catch return null;
+            indices.append(index) catch return null;
+            copied_byte_count = tokenizer.index;
+        }
+
+        pieces.append(bytes[copied_byte_count..]) catch return null;
+        bytes = instance.arena.join(pieces.constSlice()) catch unreachable;
+        const named_input_buffer = instance.arena.new_array(u32, indices.len) catch unreachable;
+        @memcpy(named_input_buffer, indices.constSlice());
+        named_inputs = named_input_buffer;
+    }
+
+    const file_descriptor = std.posix.memfd_create("nat_link_input", std.os.linux.MFD.CLOEXEC) catch return null;
+    const resident_file = std.fs.File{ .handle = file_descriptor };
+    resident_file.writeAll(bytes) catch {
+        resident_file.close();
+        return null;
+    };
+
+    const index = instance.resident_link_input_files.length;
+    _ = instance.resident_link_input_files.append(.{
+        .source_path = path,
+        .path = std.fmt.allocPrint(std.heap.page_allocator, "/proc/self/fd/{}", .{file_descriptor}) catch unreachable,
+        .size = stat.size,
+        .modification_time = stat.mtime,
+        .named_inputs = named_inputs,
+    });
+    _ = instance.resident_link_inputs.put(path, index);
+
+    return index;
+}
+
+// Like preloaded sources, a resident input is only used while the file it was loaded from (and anything it names) didn't change
+fn is_resident_link_input_valid(index: u32) bool {
+    const resident_input = &instance.resident_link_input_files.pointer[index];
+    const stat = std.fs.cwd().statFile(resident_input.source_path) catch return false;
+    if (stat.size != resident_input.size or stat.mtime != resident_input.modification_time) return false;
+
+    for (resident_input.named_inputs) |named_index| {
+        if (!is_resident_link_input_valid(named_index)) return false;
+    }
+
+    return true;
+}
+
+fn use_resident_link_inputs(arguments: *LinkArguments) void {
+    if (instance.resident_link_input_files.length == 0) return;
+
+    for (arguments.inputs.const_slice()) |argument_index| {
+        const argument = &arguments.argv.pointer[argument_index];
+        const path = arguments.resolve_input(argument.*) orelse continue;
+        const index = instance.resident_link_inputs.get(path) orelse continue;
+        if (is_resident_link_input_valid(index)) {
+            argument.* = instance.resident_link_input_files.pointer[index].path;
+        }
+    }
+}
+
+// Linker scripts (glibc's libc.so is one) pull in more files. Yields every token of a script that names a file or a library,
+// skipping comments
+const LinkerScriptTokenizer = struct{
+    bytes: []const u8,
+    index: usize = 0,
+
+    fn is_script(bytes: []const u8) bool {
+        return !library.starts_with_slice(bytes, "\x7fELF") and !library.starts_with_slice(bytes, "!<arch>\n") and !library.starts_with_slice(bytes, "!<thin>\n");
+    }
+
+    fn is_separator(ch: u8) bool {
+        return switch (ch) {
+            ' ', '\t', '\n', '\r', '(', ')', ',' => true,
+            else => false,
+        };
+    }
+
+    fn next(tokenizer: *LinkerScriptTokenizer) ?[]const u8 {
+        const bytes = tokenizer.bytes;
+        while (tokenizer.index < bytes.len) {
+            if (library.starts_with_slice(bytes[tokenizer.index..], "/*")) {
+                const comment_end = std.mem.indexOfPos(u8, bytes, tokenizer.index + 2, "*/") orelse bytes.len - 2;
+                tokenizer.index = comment_end + 2;
+                continue;
+            }
+
+            if (is_separator(bytes[tokenizer.index])) {
+                tokenizer.index += 1;
+                continue;
+            }
+
+            const start = tokenizer.index;
+            while (tokenizer.index < bytes.len and !is_separator(bytes[tokenizer.index])) {
+                tokenizer.index += 1;
+            }
+
+            const token = bytes[start..tokenizer.index];
+            if (library.starts_with_slice(token, "-l") or std.mem.indexOfAny(u8, token, "./") != null) {
+                return token;
+            }
+        }
+
+        return null;
+    }
+};
+
 const TimeRange = if (configuration.timers) struct{
     start: Instant,
     end: Instant,
@@ -4448,6 +4982,7 @@ const File = struct{
     global_declaration: GlobalDeclaration,
     scope: File.Scope,
     source_code: []const u8,
+    source_is_mapped: bool = false,
     path: []const u8,
     functions: Range = .{
         .start = 0,
@@ -4457,8 +4992,8 @@ const File = struct{
     thread: u32 = 0,
     interested_threads: PinnedArray(u32) = .{},
     interested_files: PinnedArray(*File) = .{},
-    imports: PinnedArray(*Import) = .{},
-    values_per_import: PinnedArray(PinnedArray(*Value)) = .{},
+    imports: SmallVector(*Import, 4) = .{},
+    values_per_import: SmallVector(SmallVector(*Value, 2), 4) = .{},
     resolved_import_count: u32 = 0,
     local_lazy_expressions: PinnedArray(*LocalLazyExpression) = .{},
     time: if (configuration.timers) Time else void,
@@ -4501,22 +5036,76 @@ const File = struct{
 };
 
 var instance = Instance{};
+
+const ThreadWait = enum{
+    park,
+    spin,
+    sleep,
+};
+
+var thread_wait: ThreadWait = if (configuration.sleep_on_thread_hot_loops) .sleep else .park;
+
+fn signal_wake(signal: *std.atomic.Value(u32)) void {
+    _ = signal.fetchAdd(1, .seq_cst);
+    // Always wake: threads may have parked before the wait mode was read from the command line
+    std.Thread.Futex.wake(signal, std.math.maxInt(u32));
+}
+
+// The signal value must be loaded before looking for work, so a wake up in between makes the wait return immediately
+fn signal_wait(signal: *std.atomic.Value(u32), expected: u32, sleep_ns: u64) void {
+    switch (@atomicLoad(ThreadWait, &thread_wait, .monotonic)) {
+        .park => std.Thread.Futex.wait(signal, expected),
+        .spin => std.atomic.spinLoopHint(),
+        .sleep => std.time.sleep(sleep_ns),
+    }
+}
 const do_codegen = true;
 const codegen_backend = CodegenBackend.llvm;
 
 const CodegenBackend = union(enum){
     llvm: struct {
         split_object_per_thread: bool,
+        lto: LTO,
+        // When non-zero, a thread module with more functions than this is split into partitions of about this many functions
+        // that any idle thread can optimize and emit
+        function_batch_size: u32 = 0,
+        // Number of partitions an optimized thread module is split into for machine code emission. Any idle thread can emit them
+        codegen_partition_count: u32 = 1,
+        object_emission: ObjectEmission = .disk,
     },
 };
 
+const LTO = enum{
+    none,
+    // Threads emit bitcode with a module summary; LLD builds the combined index and runs the import and backend stages in parallel
+    thin,
+};
+
+const ObjectEmission = enum{
+    // Objects go through the on-disk object cache and the linker reads them back
+    disk,
+    // Objects stay in memory and are handed to LLD as buffers. Objects that missed the cache are written to it in the background
+    // while linking, so the next build can reuse them. Only supported when linking ELF
+    memory,
+    // Like memory, but every object is also written to nat/o for inspection
+    memory_and_disk,
+};
+
+const CCompilation = enum{
+    // Every C source file is its own job and goes through the full clang driver
+    per_file,
+    // All C source files are compiled by one job that runs the cc1 invocations concurrently in-process,
+    // sharing a header lookup and contents cache between them
+    batch,
+};
+
 fn add_file(file_absolute_path: []const u8, interested_threads: []const u32) u32 {
     instance.file_mutex.lock();
     defer instance.file_mutex.unlock();
 
-    const hash = hash_bytes(file_absolute_path);
+    const file_path_id = instance.identifiers.intern(file_absolute_path);
     const new_file = instance.files.add_one();
-    _ = instance.file_paths.append(hash);
+    _ = instance.file_paths.append(file_path_id);
     const new_file_index = instance.files.get_index(new_file);
     new_file.* = .{
         .global_declaration = .{
@@ -4602,6 +5191,14 @@ const Target = struct {
 
 const Unit = struct {
     descriptor: Descriptor,
+    // Built by whichever C compilation job gets to it first; the rest wait on the mutex
+    c_precompiled_header: ?[]const u8 = null,
+    c_precompiled_header_ready: bool = false,
+    c_precompiled_header_mutex: std.Thread.Mutex = .{},
+    // Objects emitted to memory that missed the object cache. They are written to it in the background while linking
+    object_cache_write_back: PinnedArray(ObjectCacheWrite) = .{},
+    object_cache_write_back_mutex: std.Thread.Mutex = .{},
+    c_batch: ClangBatch = .{},
 
     const Descriptor = struct {
         main_source_file_path: []const u8,
@@ -4609,12 +5206,17 @@ const Unit = struct {
         object_path: []const u8,
         c_source_files: []const []const u8,
         c_object_files: []const []const u8,
+        c_prefix_header: ?[]const u8,
+        // Objects and archives linked after the unit's own objects
+        link_inputs: []const []const u8,
         target: Target,
         optimization: Optimization,
         generate_debug_information: bool,
         link_libc: bool,
         link_libcpp: bool,
         codegen_backend: CodegenBackend,
+        incremental: bool,
+        c_compilation: CCompilation,
     };
 
     fn compile(descriptor: Descriptor) *Unit {
@@ -4623,6 +5225,13 @@ const Unit = struct {
             .descriptor = descriptor,
         };
 
+        DependencyGraph.build_start_time = @truncate(std.time.nanoTimestamp());
+        if (descriptor.incremental and DependencyGraph.is_up_to_date(unit)) {
+            link_start = get_instant();
+            link_end = link_start;
+            return unit;
+        }
+
         if (descriptor.c_source_files.len > 0) {
             LLVM.initializeAll();
         } else {
@@ -4644,32 +5253,53 @@ const Unit = struct {
         for (descriptor.c_source_files) |source_file| {
             const extension_start = last_byte(source_file, '.') orelse fail();
             const name = std.fs.path.basename(source_file[0..extension_start]);
-            const object_path = instance.arena.join(&.{"nat/o/", name, ".o"}) catch unreachable;
+            // Sources with the same name in different directories must not share an object
+            const source_file_absolute = if (std.fs.path.isAbsolute(source_file)) source_file else instance.path_from_cwd(instance.arena, source_file);
+            const source_path_hash = std.hash.Wyhash.hash(0, source_file_absolute);
+            const object_path = std.fmt.allocPrint(std.heap.page_allocator, "nat/o/{s}_{x:0>16}.o", .{name, source_path_hash}) catch unreachable;
             _ = c_objects.append(object_path);
         }
 
         unit.descriptor.c_object_files = c_objects.slice();
 
+        // Any thread can steal analysis work, so all of them take part in the analysis phase
+        for (instance.threads) |*thread| {
+            thread.task_system.program_state = .analysis;
+        }
+
         const main_source_file_absolute = instance.path_from_cwd(instance.arena, unit.descriptor.main_source_file_path);
+        AnalysisState.add_unfinished_file();
         const new_file_index = add_file(main_source_file_absolute, &.{});
-        instance.threads[last_assigned_thread_index].task_system.program_state = .analysis;
-        instance.threads[last_assigned_thread_index].add_thread_work(Job{
+        instance.threads[last_assigned_thread_index].add_shared_work(Job{
             .offset = new_file_index,
             .count = 1,
             .id = .analyze_file,
         });
         last_assigned_thread_index += 1;
 
-        for (descriptor.c_source_files, 0..) |_, index| {
-            const thread_index = last_assigned_thread_index % instance.threads.len;
-            const thread = &instance.threads[thread_index];
-            thread.task_system.program_state = .analysis;
-            thread.add_thread_work(Job{
-                .offset = @intCast(index),
-                .count = 1,
-                .id = .compile_c_source_file,
-            });
-            last_assigned_thread_index += 1;
+        switch (descriptor.c_compilation) {
+            .per_file => for (descriptor.c_source_files, 0..) |_, index| {
+                const thread_index = last_assigned_thread_index % instance.threads.len;
+                const thread = &instance.threads[thread_index];
+                thread.add_shared_work(Job{
+                    .offset = @intCast(index),
+                    .count = 1,
+                    .id = .compile_c_source_file,
+                });
+                last_assigned_thread_index += 1;
+            },
+            .batch => if (descriptor.c_source_files.len > 0) {
+                const thread_index = last_assigned_thread_index % instance.threads.len;
+                const thread = &instance.threads[thread_index];
+                // Held by the job that sets the batch up, so the batch counts as pending before any of its files are queued
+                unit.c_batch.pending_count = 1;
+                thread.add_shared_work(Job{
+                    .offset = 0,
+                    .count = @intCast(descriptor.c_source_files.len),
+                    .id = .compile_c_source_batch,
+                });
+                last_assigned_thread_index += 1;
+            },
         }
 
         control_thread(unit, last_assigned_thread_index);
@@ -4685,16 +5315,27 @@ fn control_thread(unit: *Unit, lati: u32) void {
     var iterations_without_work_done: u32 = 0;
 
     while (!total_is_done) {
+        const control_signal = instance.control_signal.load(.seq_cst);
         total_is_done = first_ir_done;
 
         var task_done_this_iteration: u32 = 0;
 
         for (instance.threads, 0..) |*thread, i| {
+            if (thread.task_system.program_state == .llvm_emit_partitions and @atomicLoad(u32, &thread.llvm.pending_partitions, .acquire) == 0) {
+                thread.task_system.program_state = .llvm_finished_object;
+                first_ir_done = true;
+                task_done_this_iteration += 1;
+            }
+
             const completed = @atomicLoad(u64, &thread.task_system.job.worker.completed, .seq_cst);
             // INFO: No need to do an atomic load here since it's only this thread writing to the value
             const program_state = thread.task_system.program_state;
             const to_do = thread.task_system.job.queuer.to_do;
-            total_is_done = total_is_done and completed == to_do and if (@intFromEnum(program_state) >= @intFromEnum(TaskSystem.ProgramState.analysis) and (thread.functions.length > 0 or thread.global_variables.length > 0)) program_state == .llvm_finished_object else true;
+            const shared_completed = @atomicLoad(u64, &thread.task_system.shared.completed, .seq_cst);
+            const shared_to_do = thread.task_system.shared.next_write;
+            const owned_completed = @atomicLoad(u64, &thread.task_system.owned.completed, .seq_cst);
+            const owned_to_do = @atomicLoad(u64, &thread.task_system.owned.next_write, .seq_cst);
+            total_is_done = total_is_done and completed == to_do and shared_completed == shared_to_do and owned_completed == owned_to_do and if (@intFromEnum(program_state) >= @intFromEnum(TaskSystem.ProgramState.analysis) and (thread.functions.length > 0 or thread.global_variables.length > 0)) program_state == .llvm_finished_object else true;
 
             var previous_job: Job = undefined;
             while (thread.get_control_job()) |job| {
@@ -4711,16 +5352,22 @@ fn control_thread(unit: *Unit, lati: u32) void {
                                 fail();
                             }
                         } else {
-                            const thread_index = last_assigned_thread_index % instance.threads.len;
-                            last_assigned_thread_index += 1;
-                            const file_absolute_path = thread.identifiers.get(analyze_file_path_hash).?;
+                            // Prefer a thread that is still analyzing and isn't the one waiting on the file. This is only a hint: the
+                            // candidate can leave analysis right after the check, so the real decision is made by whoever takes the job
+                            // (see can_take). AnalysisState keeps a thread around that is allowed to take it, stealing it if necessary
+                            const thread_index = for (0..instance.threads.len) |_| {
+                                const candidate_index = last_assigned_thread_index % instance.threads.len;
+                                last_assigned_thread_index += 1;
+                                const candidate = &instance.threads[candidate_index];
+                                if (candidate_index != i and candidate.task_system.program_state == .analysis and !@atomicLoad(bool, &candidate.analysis_notified, .acquire)) break candidate_index;
+                            } else (i + 1) % instance.threads.len;
+                            const file_absolute_path = instance.identifiers.get_string(analyze_file_path_hash);
                             const interested_thread_index: u32 = @intCast(i);
                             const file_index = add_file(file_absolute_path, &.{interested_thread_index});
                             _ = instance.files.get_unchecked(file_index).interested_files.append(&instance.files.pointer[interested_file_index]);
                             const assigned_thread = &instance.threads[thread_index];
 
-                            assigned_thread.task_system.program_state = .analysis;
-                            assigned_thread.add_thread_work(Job{
+                            assigned_thread.add_shared_work(Job{
                                 .offset = file_index,
                                 .id = .analyze_file,
                                 .count = 1,
@@ -4732,7 +5379,7 @@ fn control_thread(unit: *Unit, lati: u32) void {
                         const thread_index = job.count;
                         const destination_thread = &instance.threads[thread_index];
                         const file = instance.files.get(@enumFromInt(file_index));
-                        const file_path_hash = hash_bytes(file.path);
+                        const file_path_hash = instance.file_paths.pointer[file_index];
 
                         destination_thread.add_thread_work(.{
                             .id = .notify_file_resolved,
@@ -4741,11 +5388,21 @@ fn control_thread(unit: *Unit, lati: u32) void {
                         });
                     },
                     .notify_analysis_complete => {
+                        // From now on the thread takes no new files, so its LLVM work overlaps with the analysis still going on in other threads
+                        thread.task_system.program_state = .llvm_generate_ir;
                         thread.add_thread_work(.{
                             .id = .llvm_generate_ir,
                         });
                     },
                     .llvm_notify_ir_done => {
+                        thread.add_thread_work(.{
+                            .id = switch (unit.descriptor.optimization) {
+                                .none => .llvm_emit_object,
+                                else => .llvm_optimize,
+                            },
+                        });
+                    },
+                    .llvm_notify_optimize_done => {
                         thread.add_thread_work(.{
                             .id = .llvm_emit_object,
                         });
@@ -4754,6 +5411,9 @@ fn control_thread(unit: *Unit, lati: u32) void {
                         thread.task_system.program_state = .llvm_finished_object;
                         first_ir_done = true;
                     },
+                    .llvm_notify_partitioned => {
+                        thread.task_system.program_state = .llvm_emit_partitions;
+                    },
                     else => |t| @panic(@tagName(t)),
                 }
 
@@ -4763,27 +5423,34 @@ fn control_thread(unit: *Unit, lati: u32) void {
             }
         }
 
-        total_is_done = total_is_done and task_done_this_iteration == 0;
+        // The files of a C batch are queued from inside a job, possibly on a thread that was already found done above
+        total_is_done = total_is_done and task_done_this_iteration == 0 and @atomicLoad(u32, &unit.c_batch.pending_count, .acquire) == 0;
         iterations_without_work_done += @intFromBool(task_done_this_iteration == 0);
 
-        if (configuration.sleep_on_thread_hot_loops) {
-            if (iterations_without_work_done > 5) {
-                std.time.sleep(100);
-            }
-        } else {
-            std.atomic.spinLoopHint();
+        if (!total_is_done and task_done_this_iteration == 0 and (thread_wait != .sleep or iterations_without_work_done > 5)) {
+            signal_wait(&instance.control_signal, control_signal, 100);
         }
     }
 
-    var objects = PinnedArray([]const u8){};
+    // One ordered list: whether an object comes from the cache or from memory must not change where it lands on the command line
+    var objects = PinnedArray(LinkObject){};
     for (instance.threads) |*thread| {
-        if (thread.llvm.object) |object| {
-            _ = objects.append(object);
+        if (thread.functions.length > 0 or thread.global_variables.length > 0) {
+            thread.llvm.objects.append_to(&objects);
+
+            for (thread.llvm.partitions) |partition| {
+                assert(partition.objects.count() > 0);
+                partition.objects.append_to(&objects);
+            }
         }
     }
 
     for (unit.descriptor.c_object_files) |object_path| {
-        _ = objects.append(object_path);
+        _ = objects.append(.{ .path = object_path });
+    }
+
+    for (unit.descriptor.link_inputs) |link_input| {
+        _ = objects.append(.{ .path = link_input });
     }
 
     // for (instance.threads) |*thread| {
@@ -4792,20 +5459,131 @@ fn control_thread(unit: *Unit, lati: u32) void {
 
     assert(objects.length > 0);
 
-    link_start = get_instant();
-    link(.{
+    var link_arguments = PinnedArray([]const u8){};
+    switch (unit.descriptor.codegen_backend.llvm.lto) {
+        .none => {},
+        .thin => {
+            const lto_optimization_level: u32 = switch (unit.descriptor.optimization) {
+                .none, .debug_prefer_fast, .debug_prefer_size => 0,
+                .lightly_optimize_for_speed => 1,
+                .optimize_for_speed, .optimize_for_size, .aggressively_optimize_for_size => 2,
+                .aggressively_optimize_for_speed => 3,
+            };
+            var thread_count_buffer: [16]u8 = undefined;
+            const thread_count_string = library.format_int(&thread_count_buffer, instance.threads.len, 10, false);
+            var level_buffer: [16]u8 = undefined;
+            const level_string = library.format_int(&level_buffer, lto_optimization_level, 10, false);
+
+            switch (builtin.os.tag) {
+                .windows => {
+                    _ = link_arguments.append(instance.arena.join(&.{"/opt:lldltojobs=", thread_count_string}) catch unreachable);
+                    _ = link_arguments.append(instance.arena.join(&.{"/opt:lldlto=", level_string}) catch unreachable);
+                },
+                else => {
+                    _ = link_arguments.append(instance.arena.join(&.{"--thinlto-jobs=", thread_count_string}) catch unreachable);
+                    _ = link_arguments.append(instance.arena.join(&.{"--lto-O", level_string}) catch unreachable);
+                },
+            }
+        },
+    }
+
+    const linker_options = LinkerOptions{
         .output_file_path = unit.descriptor.executable_path,
-        .extra_arguments = &.{},
+        .extra_arguments = link_arguments.const_slice(),
         .objects = objects.const_slice(),
         .libraries = &.{},
         .link_libc = true,
         .link_libcpp = false,
-    });
+    };
+
+    const object_cache_writer: ?std.Thread = if (unit.object_cache_write_back.length > 0) std.Thread.spawn(.{}, write_back_cached_objects, .{unit}) catch unreachable else null;
+
+    link_start = get_instant();
+    if (unit.descriptor.incremental) {
+        const link_key = LinkCache.get_key(linker_options);
+        if (LinkCache.is_up_to_date(linker_options, link_key)) {
+            link_skipped = true;
+        } else {
+            link(linker_options);
+            LinkCache.write(linker_options, link_key);
+        }
+    } else {
+        link(linker_options);
+    }
     link_end = get_instant();
+
+    if (object_cache_writer) |writer| {
+        writer.join();
+    }
+
+    trim_object_cache();
+
+    if (unit.descriptor.incremental) {
+        DependencyGraph.write(unit);
+    }
+}
+
+const ObjectCacheWrite = struct{
+    cached_object: []const u8,
+    temporary_object: []const u8,
+    buffer: []const u8,
+};
+
+fn write_back_cached_objects(unit: *Unit) void {
+    std.fs.cwd().makePath(object_cache_directory) catch return;
+
+    // A failed write only costs a cache miss next time
+    for (unit.object_cache_write_back.const_slice()) |object| {
+        std.fs.cwd().writeFile(.{ .sub_path = object.temporary_object, .data = object.buffer }) catch continue;
+        std.fs.cwd().rename(object.temporary_object, object.cached_object) catch {};
+    }
+}
+
+const object_cache_size_limit = 1024 * 1024 * 1024;
+
+// Deletes the least recently used objects until the cache fits in object_cache_size_limit. A hit refreshes the modification time
+// of the object, so the objects this build linked are the last to go
+fn trim_object_cache() void {
+    var directory = std.fs.cwd().openDir(object_cache_directory, .{ .iterate = true }) catch return;
+    defer directory.close();
+
+    const CachedObject = struct{
+        name: []const u8,
+        size: u64,
+        modification_time: i128,
+
+        fn is_older(_: void, a: @This(), b: @This()) bool {
+            return a.modification_time < b.modification_time;
+        }
+    };
+
+    var objects = PinnedArray(CachedObject){};
+    var total_size: u64 = 0;
+    var iterator = directory.iterate();
+    while (iterator.next() catch return) |entry| {
+        if (entry.kind != .file) continue;
+        const stat = directory.statFile(entry.name) catch continue;
+        _ = objects.append(.{
+            .name = std.heap.page_allocator.dupe(u8, entry.name) catch unreachable,
+            .size = stat.size,
+            .modification_time = stat.mtime,
+        });
+        total_size += stat.size;
+    }
+
+    if (total_size <= object_cache_size_limit) return;
+
+    std.mem.sort(CachedObject, objects.slice(), {}, CachedObject.is_older);
+    for (objects.const_slice()) |object| {
+        if (total_size <= object_cache_size_limit) break;
+        directory.deleteFile(object.name) catch continue;
+        total_size -= object.size;
+    }
 }
 
 var link_start: Instant = undefined;
 var link_end: Instant = undefined;
+var link_skipped = false;
 
 fn command_exe(arguments: []const []const u8) void {
     if (arguments.len == 0) {
@@ -4836,9 +5614,17 @@ fn command_exe(arguments: []const []const u8) void {
     var maybe_main_source_file_path: ?[]const u8 = null;
 
     var c_source_files = PinnedArray([]const u8){};
+    var link_inputs = PinnedArray([]const u8){};
 
     var optimization = Optimization.none;
+    var lto = LTO.none;
+    var function_batch_size: u32 = 0;
+    var codegen_partition_count: u32 = 1;
+    var object_emission = ObjectEmission.disk;
+    var c_compilation = CCompilation.per_file;
+    var c_prefix_header: ?[]const u8 = null;
     var generate_debug_information = true;
+    var incremental = false;
     var link_libc = true;
     const link_libcpp = false;
 
@@ -4904,6 +5690,72 @@ fn command_exe(arguments: []const []const u8) void {
             } else {
                 error_unterminated_argument(current_argument);
             }
+        } else if (byte_equal(current_argument, "-lto")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                const lto_string = arguments[i];
+                lto = library.enumFromString(LTO, lto_string) orelse unreachable;
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else if (byte_equal(current_argument, "-object_emission")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                const object_emission_string = arguments[i];
+                object_emission = library.enumFromString(ObjectEmission, object_emission_string) orelse unreachable;
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else if (byte_equal(current_argument, "-function_batch_size")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                const function_batch_size_string = arguments[i];
+                function_batch_size = std.fmt.parseInt(u32, function_batch_size_string, 10) catch unreachable;
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else if (byte_equal(current_argument, "-codegen_partitions")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                const codegen_partitions_string = arguments[i];
+                codegen_partition_count = std.fmt.parseInt(u32, codegen_partitions_string, 10) catch unreachable;
+                if (codegen_partition_count == 0) {
+                    fail_message("Codegen partition count must be at least one");
+                }
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else if (byte_equal(current_argument, "-c_compilation")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                const c_compilation_string = arguments[i];
+                c_compilation = library.enumFromString(CCompilation, c_compilation_string) orelse unreachable;
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else if (byte_equal(current_argument, "-c_prefix_header")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                c_prefix_header = arguments[i];
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else if (byte_equal(current_argument, "-thread_wait")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                const thread_wait_string = arguments[i];
+                const new_thread_wait = library.enumFromString(ThreadWait, thread_wait_string) orelse unreachable;
+                @atomicStore(ThreadWait, &thread_wait, new_thread_wait, .monotonic);
+            } else {
+                error_unterminated_argument(current_argument);
+            }
         } else if (byte_equal(current_argument, "-debug")) {
             if (i + 1 != arguments.len) {
                 i += 1;
@@ -4913,6 +5765,15 @@ fn command_exe(arguments: []const []const u8) void {
             } else {
                 error_unterminated_argument(current_argument);
             }
+        } else if (byte_equal(current_argument, "-incremental")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                const incremental_string = arguments[i];
+                incremental = if (byte_equal(incremental_string, "true")) true else if (byte_equal(incremental_string, "false")) false else fail_message("-incremental expects true or false");
+            } else {
+                error_unterminated_argument(current_argument);
+            }
         } else if (byte_equal(current_argument, "-c_source_files_start")) {
             i += 1;
             var sentinel = false;
@@ -4929,6 +5790,22 @@ fn command_exe(arguments: []const []const u8) void {
             if (!sentinel) {
                 fail_message("No sentinel for C source files arguments");
             }
+        } else if (byte_equal(current_argument, "-link_inputs_start")) {
+            i += 1;
+            var sentinel = false;
+            while (i < arguments.len) : (i += 1) {
+                const arg = arguments[i];
+                if (byte_equal(arg, "-link_inputs_end")) {
+                    sentinel = true;
+                    break;
+                }
+
+                _ = link_inputs.append(arg);
+            }
+
+            if (!sentinel) {
+                fail_message("No sentinel for link input arguments");
+            }
         } else {
             @panic(current_argument);
             // std.debug.panic("Unrecognized argument: {s}", .{current_argument});
@@ -4959,19 +5836,177 @@ fn command_exe(arguments: []const []const u8) void {
         .executable_path = executable_path,
         .c_source_files = c_source_files.slice(),
         .c_object_files = &.{},
+        .link_inputs = link_inputs.slice(),
+        .c_prefix_header = c_prefix_header,
         .optimization = optimization,
         .generate_debug_information = generate_debug_information,
+        .incremental = incremental,
+        .c_compilation = c_compilation,
         .codegen_backend = .{
             .llvm = .{
                 .split_object_per_thread = true,
+                .lto = lto,
+                .function_batch_size = function_batch_size,
+                .codegen_partition_count = codegen_partition_count,
+                .object_emission = if (builtin.os.tag == .linux) object_emission else .disk,
             },
         },
     });
 }
 
+// Packs objects into a static library: nat ar -o <archive> [-thin true|false] -members <object>...
+// Thin archives only reference their members, by path relative to the archive, so they must stay where they are
+fn command_ar(arguments: []const []const u8) void {
+    var maybe_archive_path: ?[]const u8 = null;
+    var thin = false;
+    var members = PinnedArray([]const u8){};
+
+    var i: usize = 0;
+    while (i < arguments.len) : (i += 1) {
+        const current_argument = arguments[i];
+        if (byte_equal(current_argument, "-o")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+                maybe_archive_path = arguments[i];
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else if (byte_equal(current_argument, "-thin")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                const thin_string = arguments[i];
+                thin = if (byte_equal(thin_string, "true")) true else if (byte_equal(thin_string, "false")) false else unreachable;
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else if (byte_equal(current_argument, "-members")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+
+                members.append_slice(arguments[i..]);
+                i = arguments.len;
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else {
+            fail_term("Unrecognized ar argument", current_argument);
+        }
+    }
+
+    const archive_path = maybe_archive_path orelse fail_message("Archive path must be specified with -o");
+    if (members.length == 0) {
+        fail_message("Archive members must be specified with -members");
+    }
+
+    if (std.fs.path.dirname(archive_path)) |archive_directory| {
+        std.fs.cwd().makePath(archive_directory) catch unreachable;
+    }
+
+    const member_path_lengths = instance.arena.new_array(usize, members.length) catch unreachable;
+    const member_path_pointers = instance.arena.new_array([*]const u8, members.length) catch unreachable;
+    for (members.const_slice(), member_path_pointers, member_path_lengths) |member, *pointer, *length| {
+        pointer.* = member.ptr;
+        length.* = member.len;
+    }
+
+    var error_ptr: [*]const u8 = undefined;
+    var error_len: usize = 0;
+    // The worker threads are idle outside of a compilation, so the archiver can use every core
+    const thread_count: c_uint = @intCast(instance.threads.len + 1);
+    if (!NativityLLVMArchiveWrite(archive_path.ptr, archive_path.len, member_path_pointers.ptr, member_path_lengths.ptr, null, null, members.length, thread_count, thin, &error_ptr, &error_len)) {
+        write(error_ptr[0..error_len]);
+        fail_term("Unable to write archive", archive_path);
+    }
+}
+
+// Builds musl into a content-addressed cache: nat musl [-o <directory>]. The objects are compiled by `nat clang` children and
+// archived by `nat ar`, so a warm run only hashes the sources. The musl sources are looked up in the lib/libc directory next to lib/std
+fn command_musl(arguments: []const []const u8) void {
+    var maybe_cache_directory: ?[]const u8 = null;
+
+    var i: usize = 0;
+    while (i < arguments.len) : (i += 1) {
+        const current_argument = arguments[i];
+        if (byte_equal(current_argument, "-o")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+                maybe_cache_directory = arguments[i];
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else {
+            fail_term("Unrecognized musl argument", current_argument);
+        }
+    }
+
+    const cache_directory = maybe_cache_directory orelse b: {
+        const home_directory = std.posix.getenv("HOME") orelse fail_message("HOME is not set; specify the musl directory with -o");
+        break :b instance.arena.join(&.{ home_directory, "/.cache/nat/musl" }) catch unreachable;
+    };
+    const root_path = instance.arena.join(&.{ instance.paths.executable_directory, "/.." }) catch unreachable;
+
+    // The worker threads are idle outside of a compilation, so the musl build can use every core
+    musl.build(instance.arena, instance.paths.executable, root_path, cache_directory, instance.threads.len + 1) catch |err| {
+        fail_term("Unable to build musl", @errorName(err));
+    };
+}
+
+// A thin archive only holds the paths of its members, relative to the archive, so whatever is keyed on an archive has to look at
+// the members as well. Returns nothing for any other file
+fn get_thin_archive_members(archive_path: []const u8, bytes: []const u8) []const []const u8 {
+    if (!library.starts_with_slice(bytes, "!<thin>\n")) return &.{};
+
+    var members = PinnedArray([]const u8){};
+    const archive_directory = std.fs.path.dirname(archive_path) orelse ".";
+    var long_names: []const u8 = &.{};
+    var offset: usize = "!<thin>\n".len;
+    const header_size = 60;
+
+    while (offset + header_size <= bytes.len) {
+        const header = bytes[offset..][0..header_size];
+        const name = std.mem.trimRight(u8, header[0..16], " ");
+        const size = std.fmt.parseInt(usize, std.mem.trimRight(u8, header[48..58], " "), 10) catch break;
+        offset += header_size;
+
+        if (byte_equal(name, "/") or byte_equal(name, "/SYM64/")) {
+            offset += size + (size & 1);
+        } else if (byte_equal(name, "//")) {
+            if (offset + size > bytes.len) break;
+            long_names = bytes[offset..][0..size];
+            offset += size + (size & 1);
+        } else {
+            // Members only have a header, their contents stay in the member file
+            const member_name = if (name.len > 1 and name[0] == '/') b: {
+                const name_offset = std.fmt.parseInt(usize, name[1..], 10) catch break;
+                const name_end = std.mem.indexOfPos(u8, long_names, name_offset, "/\n") orelse break;
+                break :b long_names[name_offset..name_end];
+            } else std.mem.trimRight(u8, name, "/");
+
+            _ = members.append(if (std.fs.path.isAbsolute(member_name)) member_name else instance.arena.join(&.{ archive_directory, "/", member_name }) catch unreachable);
+        }
+    }
+
+    return members.const_slice();
+}
+
+extern fn NativityLLVMArchiveWrite(archive_path_ptr: [*]const u8, archive_path_len: usize, member_path_ptrs: [*]const [*]const u8, member_path_lens: [*]const usize, member_buffer_ptrs: ?[*]const ?[*]const u8, member_buffer_lens: ?[*]const usize, member_count: usize, thread_count: c_uint, thin: bool, error_ptr: *[*]const u8, error_len: *usize) bool;
+
 pub fn main() void {
-    const program_start = get_instant();
     instance.arena = library.Arena.init(4 * 1024 * 1024) catch unreachable;
+
+    var arg_iterator = std.process.args();
+    var argument_buffer = PinnedArray([]const u8){};
+
+    while (arg_iterator.next()) |arg| {
+        _ = argument_buffer.append(arg);
+    }
+
+    // The server has to run before any worker thread is spawned since it forks for every request.
+    // It only returns in the forked process, with the arguments of the request
+    const arguments = if (argument_buffer.length >= 2 and byte_equal(argument_buffer.pointer[1], "server")) command_server(argument_buffer.const_slice()[2..]) else argument_buffer.const_slice();
+
+    const program_start = get_instant();
     const executable_path = library.self_exe_path(instance.arena) catch unreachable;
     const executable_directory = std.fs.path.dirname(executable_path).?;
     std.fs.cwd().makePath("nat") catch |err| switch (err) {
@@ -4985,7 +6020,12 @@ pub fn main() void {
         .executable = executable_path,
         .executable_directory = executable_directory,
     };
-    const thread_count = std.Thread.getCpuCount() catch unreachable;
+    // Id 0 is the discard identifier. Interning it here also reserves the id table before any worker can read from it
+    const discard_identifier = instance.identifiers.intern("_");
+    assert(discard_identifier == 0);
+    // A file is never analyzed by the thread waiting on it (see can_take), so an import needs a second worker to make progress.
+    // Hosts with fewer than three cores get two workers anyway
+    const thread_count = @max(std.Thread.getCpuCount() catch unreachable, 3);
     const cpu_count = &cpu_count_buffer[0];
     instance.arena.align_forward(@alignOf(Thread));
     instance.threads = instance.arena.new_array(Thread, thread_count - 1) catch unreachable;
@@ -4993,18 +6033,11 @@ pub fn main() void {
     for (instance.threads) |*thread| {
         thread.* = .{};
     }
+    AnalysisState.init(@intCast(instance.threads.len));
 
     const thread_index = cpu_count.*;
     instance.threads[thread_index].handle = std.Thread.spawn(.{}, worker_thread, .{thread_index, cpu_count}) catch unreachable;
 
-    var arg_iterator = std.process.args();
-    var argument_buffer = PinnedArray([]const u8){};
-
-    while (arg_iterator.next()) |arg| {
-        _ = argument_buffer.append(arg);
-    }
-
-    const arguments = argument_buffer.const_slice();
     if (arguments.len < 2) {
         fail_message("Insufficient number of arguments");
     }
@@ -5014,8 +6047,17 @@ pub fn main() void {
 
     if (byte_equal(command, "exe")) {
         command_exe(command_arguments);
+    } else if (byte_equal(command, "ar")) {
+        command_ar(command_arguments);
+    } else if (byte_equal(command, "musl")) {
+        command_musl(command_arguments);
     } else if (byte_equal(command, "clang") or byte_equal(command, "-cc1") or byte_equal(command, "-cc1as")) {
-        fail_message("TODO: clang");
+        // The driver skips the command name itself, but keeps -cc1 and -cc1as since they select the tool
+        const argv = library.argument_copy_zero_terminated(instance.arena, arguments) catch unreachable;
+        const exit_code = nat_clang_main(@intCast(arguments.len), argv.ptr);
+        if (exit_code != 0) {
+            std.posix.exit(@intCast(exit_code));
+        }
     } else if (byte_equal(command, "cc")) {
         fail_message("TODO: clang");
     } else if (byte_equal(command, "c++")) {
@@ -5026,6 +6068,17 @@ pub fn main() void {
 
     const program_end = get_instant();
 
+    // Printed regardless of the timers since the test runner checks C object reuse with it
+    var c_object_lookups: u32 = 0;
+    var c_object_reuses: u32 = 0;
+    for (instance.threads) |*thread| {
+        c_object_lookups += thread.c_object_lookups;
+        c_object_reuses += thread.c_object_reuses;
+    }
+    if (c_object_lookups != 0) {
+        std.debug.print("C objects: {}/{} reused\n", .{c_object_reuses, c_object_lookups});
+    }
+
     const print_timers = configuration.timers;
     if (print_timers) {
         for (instance.files.slice()) |*file| {
@@ -5056,14 +6109,35 @@ pub fn main() void {
                 const ms = @as(f64, @floatFromInt(ns)) / 1000_000.0;
                 std.debug.print("- {s}: {d} ns ({d:.02} ms)\n", .{@tagName(timer_entry.key), ns, ms});
             }
+            std.debug.print("- steals: {}\n", .{thread.steal_count});
+            std.debug.print("- partitions emitted: {}\n", .{thread.emitted_partition_count});
+            std.debug.print("- imported declarations: {} ({} reused)\n", .{thread.imported_declarations.length, thread.imported_declaration_reuse_count});
         }
 
         {
             const ns = link_end.since(link_start);
             const ms = @as(f64, @floatFromInt(ns)) / 1000_000.0;
-            std.debug.print("Link time: {} ns ({d:.02} ms)\n", .{ns, ms});
+            std.debug.print("Link time: {} ns ({d:.02} ms){s}\n", .{ns, ms, if (link_skipped) " (skipped, inputs unchanged)" else ""});
+
+            var object_cache_lookups: u32 = 0;
+            var object_cache_hits: u32 = 0;
+            for (instance.threads) |*thread| {
+                object_cache_lookups += thread.object_cache_lookups;
+                object_cache_hits += thread.object_cache_hits;
+            }
+            const hit_rate = if (object_cache_lookups == 0) 0 else @as(f64, @floatFromInt(object_cache_hits)) * 100.0 / @as(f64, @floatFromInt(object_cache_lookups));
+            std.debug.print("Object cache: {}/{} hits ({d:.02}%)\n", .{object_cache_hits, object_cache_lookups, hit_rate});
         }
 
+        {
+            const page_faults = library.get_page_faults();
+            const statistics = &library.memory_statistics;
+            const committed_mb = @as(f64, @floatFromInt(statistics.committed_bytes.load(.monotonic))) / (1024.0 * 1024.0);
+            std.debug.print("Memory: {} commit syscalls ({d:.02} MiB committed), {} advise syscalls. Page faults: {} minor, {} major\n", .{statistics.commit_syscalls.load(.monotonic), committed_mb, statistics.advise_syscalls.load(.monotonic), page_faults.minor, page_faults.major});
+        }
+
+        print_stage_occupancy(program_start, program_end);
+
         {
             const ns = program_end.since(program_start);
             const ms = @as(f64, @floatFromInt(ns)) / 1000_000.0;
@@ -5073,17 +6147,224 @@ pub fn main() void {
     }
 }
 
+// Prints, for every stage, the average number of busy threads in each time slice of the program
+fn print_stage_occupancy(program_start: Instant, program_end: Instant) void {
+    const slice_count = 64;
+    const program_ns = program_end.since(program_start);
+    const slice_ns = @max(std.math.divCeil(u64, program_ns, slice_count) catch unreachable, 1);
+    var busy_ns = std.EnumArray(Thread.Stage, [slice_count]u64).initFill([1]u64{0} ** slice_count);
+
+    for (instance.threads) |*thread| {
+        for (thread.stage_spans.slice()) |span| {
+            const span_start = span.start.since(program_start);
+            const span_end = span.end.since(program_start);
+            const busy = busy_ns.getPtr(span.stage);
+            var slice_index = span_start / slice_ns;
+            while (slice_index < slice_count and slice_index * slice_ns < span_end) : (slice_index += 1) {
+                const slice_start = slice_index * slice_ns;
+                busy[slice_index] += @min(span_end, slice_start + slice_ns) - @max(span_start, slice_start);
+            }
+        }
+    }
+
+    std.debug.print("Occupancy (average busy threads per {d:.02} ms slice, '.' is idle, '+' is 10 or more):\n", .{@as(f64, @floatFromInt(slice_ns)) / 1000_000.0});
+    var it = busy_ns.iterator();
+    while (it.next()) |entry| {
+        var row: [slice_count]u8 = undefined;
+        for (&row, entry.value.*) |*character, ns| {
+            const busy_threads = (ns + slice_ns / 2) / slice_ns;
+            character.* = if (ns == 0) '.' else if (busy_threads >= 10) '+' else '0' + @as(u8, @intCast(busy_threads));
+        }
+        std.debug.print("- {s:<16} |{s}|\n", .{@tagName(entry.key), &row});
+    }
+}
+
+// Compiler server. It keeps the process image, initialized LLVM targets, lib/std and other preloaded sources (with their identifiers
+// already interned) and the crt and libc link inputs resident, and serves every request from a forked copy of itself, so a request
+// pays for neither process startup nor the warm-up and starts from a clean compiler state. Analysis results are not kept: they live in
+// the worker threads' state, and a forked process starts with none of the parent's threads.
+// Requests are served one at a time since a single build already uses every core.
+//
+// Protocol over a Unix stream socket, all integers are native-endian u32:
+// - Request: working directory length and bytes, argument count, then the length and bytes of every argument (starting with the command)
+// - Response: everything the build wrote to stdout and stderr, followed by the exit status. The server then closes the connection
+fn command_server(arguments: []const []const u8) []const []const u8 {
+    // Same id as in a regular run, see main
+    const discard_identifier = instance.identifiers.intern("_");
+    assert(discard_identifier == 0);
+
+    // The standard library is always kept resident, next to whatever was asked for
+    const executable_path = library.self_exe_path(instance.arena) catch unreachable;
+    const standard_library_path = instance.arena.join(&.{ std.fs.path.dirname(executable_path).?, "/../lib/std" }) catch unreachable;
+    if (std.fs.cwd().access(standard_library_path, .{})) |_| {
+        add_resident_sources(standard_library_path);
+    } else |_| {}
+
+    var socket_path: []const u8 = "nat/server.sock";
+    var i: usize = 0;
+    while (i < arguments.len) : (i += 1) {
+        const current_argument = arguments[i];
+        if (byte_equal(current_argument, "-socket")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+                socket_path = arguments[i];
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else if (byte_equal(current_argument, "-preload")) {
+            if (i + 1 != arguments.len) {
+                i += 1;
+                add_resident_sources(arguments[i]);
+            } else {
+                error_unterminated_argument(current_argument);
+            }
+        } else {
+            fail_term("Unrecognized server argument", current_argument);
+        }
+    }
+
+    LLVM.initializeAll();
+    if (builtin.os.tag == .linux) {
+        add_resident_link_inputs();
+    }
+
+    const listener = std.posix.socket(std.posix.AF.UNIX, std.posix.SOCK.STREAM | std.posix.SOCK.CLOEXEC, 0) catch unreachable;
+    const address = std.net.Address.initUnix(socket_path) catch unreachable;
+    std.fs.cwd().deleteFile(socket_path) catch {};
+    std.posix.bind(listener, &address.any, address.getOsSockLen()) catch unreachable;
+    std.posix.listen(listener, 16) catch unreachable;
+
+    while (true) {
+        const connection = std.posix.accept(listener, null, null, std.posix.SOCK.CLOEXEC) catch continue;
+        const request = server_read_request(connection) orelse {
+            std.posix.close(connection);
+            continue;
+        };
+
+        const pid = std.posix.fork() catch unreachable;
+        if (pid == 0) {
+            std.posix.close(listener);
+            std.posix.chdir(request.working_directory) catch std.posix.exit(1);
+            std.posix.dup2(connection, std.posix.STDOUT_FILENO) catch unreachable;
+            std.posix.dup2(connection, std.posix.STDERR_FILENO) catch unreachable;
+            std.posix.close(connection);
+            return request.arguments;
+        }
+
+        const wait_result = std.posix.waitpid(pid, 0);
+        const status: u32 = if (std.posix.W.IFEXITED(wait_result.status)) std.posix.W.EXITSTATUS(wait_result.status) else 128 + std.posix.W.TERMSIG(wait_result.status);
+        _ = std.posix.write(connection, std.mem.asBytes(&status)) catch 0;
+        std.posix.close(connection);
+
+        // Whatever the request allocated belongs to the forked process
+        instance.arena.position = server_arena_position;
+    }
+}
+
+var server_arena_position: u64 = 0;
+
+fn server_read_exact(connection: std.posix.socket_t, bytes: []u8) bool {
+    var offset: usize = 0;
+    while (offset < bytes.len) {
+        const read_byte_count = std.posix.read(connection, bytes[offset..]) catch return false;
+        if (read_byte_count == 0) return false;
+        offset += read_byte_count;
+    }
+
+    return true;
+}
+
+fn server_read_string(connection: std.posix.socket_t) ?[]const u8 {
+    var length: u32 = 0;
+    if (!server_read_exact(connection, std.mem.asBytes(&length))) return null;
+    const bytes = instance.arena.new_array(u8, length) catch unreachable;
+    if (!server_read_exact(connection, bytes)) return null;
+    return bytes;
+}
+
+const ServerRequest = struct{
+    working_directory: []const u8,
+    // Arguments as if the compiler had been invoked directly
+    arguments: []const []const u8,
+};
+
+fn server_read_request(connection: std.posix.socket_t) ?ServerRequest {
+    server_arena_position = instance.arena.position;
+    const working_directory = server_read_string(connection) orelse return null;
+
+    var argument_count: u32 = 0;
+    if (!server_read_exact(connection, std.mem.asBytes(&argument_count))) return null;
+    const request_arguments = instance.arena.new_array([]const u8, argument_count + 1) catch unreachable;
+    request_arguments[0] = "nat";
+    for (request_arguments[1..]) |*argument| {
+        argument.* = server_read_string(connection) orelse return null;
+    }
+
+    return .{
+        .working_directory = working_directory,
+        .arguments = request_arguments,
+    };
+}
+
+// An object to link: a file, or an object that only lives in memory (only supported when linking ELF)
+const LinkObject = union(enum){
+    path: []const u8,
+    buffer: []const u8,
+};
+
 const LinkerOptions = struct {
     output_file_path: []const u8,
     extra_arguments: []const []const u8,
-    objects: []const []const u8,
+    objects: []const LinkObject,
     libraries: []const []const u8,
     link_libc: bool,
     link_libcpp: bool,
 };
 
-pub fn link(options: LinkerOptions) void {
-    var argv = PinnedArray([]const u8){};
+// The full command line LLD is invoked with. Inputs and search paths are recorded as they are added, so the link cache and the
+// compiler server see exactly the files LLD is going to read
+const LinkArguments = struct{
+    argv: PinnedArray([]const u8) = .{},
+    // Index in `argv` of every argument naming an input file or a library
+    inputs: PinnedArray(u32) = .{},
+    search_paths: PinnedArray([]const u8) = .{},
+    // In-memory objects, each standing in for the placeholder argument at the same position in `buffer_argument_indices`
+    buffers: PinnedArray([]const u8) = .{},
+    buffer_argument_indices: PinnedArray(usize) = .{},
+
+    fn add_input(arguments: *LinkArguments, input: []const u8) void {
+        _ = arguments.inputs.append(arguments.argv.length);
+        _ = arguments.argv.append(input);
+    }
+
+    fn add_search_path(arguments: *LinkArguments, search_path: []const u8) void {
+        _ = arguments.search_paths.append(search_path);
+        arguments.argv.append_slice(&.{ "-L", search_path });
+    }
+
+    // Finds the file an input argument makes LLD read. Libraries are looked up like LLD does, shared before static
+    fn resolve_input(arguments: *const LinkArguments, input: []const u8) ?[]const u8 {
+        if (!library.starts_with_slice(input, "-l")) {
+            return input;
+        }
+
+        const name = input[2..];
+        for (arguments.search_paths.const_slice()) |search_path| {
+            for ([_][]const u8{ ".so", ".a" }) |extension| {
+                const path = std.fmt.allocPrint(std.heap.page_allocator, "{s}/lib{s}{s}", .{ search_path, name, extension }) catch unreachable;
+                if (std.fs.cwd().access(path, .{})) |_| {
+                    return path;
+                } else |_| {}
+            }
+        }
+
+        return null;
+    }
+};
+
+fn get_link_arguments(options: LinkerOptions) LinkArguments {
+    var arguments = LinkArguments{};
+    const argv = &arguments.argv;
     const driver_program = switch (builtin.os.tag) {
         .windows => "lld-link",
         .linux => "ld.lld",
@@ -5111,7 +6392,14 @@ pub fn link(options: LinkerOptions) void {
     argv.append_slice(options.extra_arguments);
 
     for (options.objects) |object| {
-        _ = argv.append(object);
+        switch (object) {
+            .path => |path| arguments.add_input(path),
+            .buffer => |buffer| {
+                _ = arguments.buffers.append(buffer);
+                _ = arguments.buffer_argument_indices.append(argv.length);
+                _ = argv.append("(object in memory)");
+            },
+        }
     }
 
     const ci = configuration.ci;
@@ -5142,33 +6430,33 @@ pub fn link(options: LinkerOptions) void {
             if (ci) {
                 if (options.link_libcpp) {
                     assert(options.link_libc);
-                    _ = argv.append("/lib/x86_64-linux-gnu/libstdc++.so.6");
+                    arguments.add_input("/lib/x86_64-linux-gnu/libstdc++.so.6");
                 }
 
                 if (options.link_libc) {
-                    _ = argv.append("/lib/x86_64-linux-gnu/crt1.o");
-                    _ = argv.append("/lib/x86_64-linux-gnu/crti.o");
-                    argv.append_slice(&.{ "-L", "/lib/x86_64-linux-gnu" });
+                    arguments.add_input("/lib/x86_64-linux-gnu/crt1.o");
+                    arguments.add_input("/lib/x86_64-linux-gnu/crti.o");
+                    arguments.add_search_path("/lib/x86_64-linux-gnu");
                     argv.append_slice(&.{ "-dynamic-linker", "/lib64/ld-linux-x86-64.so.2" });
                     _ = argv.append("--as-needed");
-                    _ = argv.append("-lm");
-                    _ = argv.append("-lpthread");
-                    _ = argv.append("-lc");
-                    _ = argv.append("-ldl");
-                    _ = argv.append("-lrt");
-                    _ = argv.append("-lutil");
-                    _ = argv.append("/lib/x86_64-linux-gnu/crtn.o");
+                    arguments.add_input("-lm");
+                    arguments.add_input("-lpthread");
+                    arguments.add_input("-lc");
+                    arguments.add_input("-ldl");
+                    arguments.add_input("-lrt");
+                    arguments.add_input("-lutil");
+                    arguments.add_input("/lib/x86_64-linux-gnu/crtn.o");
                 }
             } else {
                 if (options.link_libcpp) {
                     assert(options.link_libc);
-                    _ = argv.append("/usr/lib64/libstdc++.so.6");
+                    arguments.add_input("/usr/lib64/libstdc++.so.6");
                 }
 
                 if (options.link_libc) {
-                    _ = argv.append("/usr/lib64/crt1.o");
-                    _ = argv.append("/usr/lib64/crti.o");
-                    argv.append_slice(&.{ "-L", "/usr/lib64" });
+                    arguments.add_input("/usr/lib64/crt1.o");
+                    arguments.add_input("/usr/lib64/crti.o");
+                    arguments.add_search_path("/usr/lib64");
 
                     _ = argv.append("-dynamic-linker");
                     switch (builtin.cpu.arch) {
@@ -5178,14 +6466,14 @@ pub fn link(options: LinkerOptions) void {
                     }
 
                     _ = argv.append("--as-needed");
-                    _ = argv.append("-lm");
-                    _ = argv.append("-lpthread");
-                    _ = argv.append("-lc");
-                    _ = argv.append("-ldl");
-                    _ = argv.append("-lrt");
-                    _ = argv.append("-lutil");
-
-                    _ = argv.append("/usr/lib64/crtn.o");
+                    arguments.add_input("-lm");
+                    arguments.add_input("-lpthread");
+                    arguments.add_input("-lc");
+                    arguments.add_input("-ldl");
+                    arguments.add_input("-lrt");
+                    arguments.add_input("-lutil");
+
+                    arguments.add_input("/usr/lib64/crtn.o");
                 }
             }
         },
@@ -5194,7 +6482,18 @@ pub fn link(options: LinkerOptions) void {
     }
 
     for (options.libraries) |lib| {
-        _ = argv.append(instance.arena.join(&.{ "-l", lib }) catch unreachable);
+        arguments.add_input(instance.arena.join(&.{ "-l", lib }) catch unreachable);
+    }
+
+    return arguments;
+}
+
+pub fn link(options: LinkerOptions) void {
+    var arguments = get_link_arguments(options);
+    const argv = &arguments.argv;
+
+    if (builtin.os.tag == .linux) {
+        use_resident_link_inputs(&arguments);
     }
 
     const argv_zero_terminated = library.argument_copy_zero_terminated(instance.arena, argv.const_slice()) catch unreachable;
@@ -5204,7 +6503,16 @@ pub fn link(options: LinkerOptions) void {
     var stderr_ptr: [*]const u8 = undefined;
     var stderr_len: usize = 0;
     const result = switch (builtin.os.tag) {
-        .linux => NativityLLDLinkELF(argv_zero_terminated.ptr, argv_zero_terminated.len, &stdout_ptr, &stdout_len, &stderr_ptr, &stderr_len),
+        .linux => if (arguments.buffers.length > 0) b: {
+            const buffer_pointers = instance.arena.new_array([*]const u8, arguments.buffers.length) catch unreachable;
+            const buffer_lengths = instance.arena.new_array(usize, arguments.buffers.length) catch unreachable;
+            for (arguments.buffers.const_slice(), buffer_pointers, buffer_lengths) |buffer, *pointer, *length| {
+                pointer.* = buffer.ptr;
+                length.* = buffer.len;
+            }
+
+            break :b NativityLLDLinkELFBuffers(argv_zero_terminated.ptr, argv_zero_terminated.len, arguments.buffer_argument_indices.pointer, buffer_pointers.ptr, buffer_lengths.ptr, buffer_pointers.len, &stdout_ptr, &stdout_len, &stderr_ptr, &stderr_len);
+        } else NativityLLDLinkELF(argv_zero_terminated.ptr, argv_zero_terminated.len, &stdout_ptr, &stdout_len, &stderr_ptr, &stderr_len),
         .macos => NativityLLDLinkMachO(argv_zero_terminated.ptr, argv_zero_terminated.len, &stdout_ptr, &stdout_len, &stderr_ptr, &stderr_len),
         .windows => NativityLLDLinkCOFF(argv_zero_terminated.ptr, argv_zero_terminated.len, &stdout_ptr, &stdout_len, &stderr_ptr, &stderr_len),
         else => @compileError("OS not supported"),
@@ -5233,17 +6541,40 @@ pub fn link(options: LinkerOptions) void {
 }
 
 extern fn NativityLLDLinkELF(argument_ptr: [*:null]?[*:0]u8, argument_count: usize, stdout_ptr: *[*]const u8, stdout_len: *usize, stderr_ptr: *[*]const u8, stderr_len: *usize) bool;
+extern fn NativityLLDLinkELFBuffers(argument_ptr: [*:null]?[*:0]u8, argument_count: usize, buffer_argument_indices: [*]const usize, buffer_ptrs: [*]const [*]const u8, buffer_lens: [*]const usize, buffer_count: usize, stdout_ptr: *[*]const u8, stdout_len: *usize, stderr_ptr: *[*]const u8, stderr_len: *usize) bool;
 extern fn NativityLLDLinkCOFF(argument_ptr: [*:null]?[*:0]u8, argument_count: usize, stdout_ptr: *[*]const u8, stdout_len: *usize, stderr_ptr: *[*]const u8, stderr_len: *usize) bool;
 extern fn NativityLLDLinkMachO(argument_ptr: [*:null]?[*:0]u8, argument_count: usize, stdout_ptr: *[*]const u8, stdout_len: *usize, stderr_ptr: *[*]const u8, stderr_len: *usize) bool;
 extern fn NativityLLDLinkWasm(argument_ptr: [*:null]?[*:0]u8, argument_count: usize, stdout_ptr: *[*]const u8, stdout_len: *usize, stderr_ptr: *[*]const u8, stderr_len: *usize) bool;
 
-fn intern_identifier(pool: *PinnedHashMap(u32, []const u8), identifier: []const u8) u32 {
+// Per-thread memo of imported functions: a foreign function is cloned once per importing thread and every later call site reuses
+// that copy, instead of declaring the same function again for each call. It is not a shared store, every importing thread still
+// holds its own copy of the declaration and its function type. LLVM handles no longer live on the nodes, so they are not what keeps
+// the copy around: types are compared by identity and every thread has its own integer types, and the importing thread declares the
+// function extern while the owner exports it
+fn get_imported_declaration(thread: *Thread, declaration: *Function.Declaration) *Function.Declaration {
+    if (thread.imported_declarations.get(declaration)) |imported_declaration| {
+        thread.imported_declaration_reuse_count += 1;
+        return imported_declaration;
+    }
+
+    const imported_declaration = declaration.clone(thread);
+    _ = thread.imported_declarations.put_no_clobber(declaration, imported_declaration);
+    return imported_declaration;
+}
+
+fn intern_identifier(thread: *Thread, identifier: []const u8) u32 {
     const start_index = @intFromBool(identifier[0] == '"');
     const end_index = identifier.len - start_index;
-    const hash = hash_bytes(identifier[start_index..end_index]);
-    _ = pool.put(hash, identifier);
+    const name = identifier[start_index..end_index];
+
+    if (thread.identifier_cache.get(name)) |id| {
+        return id;
+    }
+
+    const id = instance.identifiers.intern(name);
+    _ = thread.identifier_cache.put_no_clobber(name, id);
 
-    return hash;
+    return id;
 }
 
 const CallingConvention = enum{
@@ -5255,6 +6586,7 @@ const Analyzer = struct{
     current_basic_block: *BasicBlock,
     current_function: *Function,
     current_scope: *Scope,
+    arena: *Arena,
     exit_blocks: PinnedArray(*BasicBlock) = .{},
     loops: PinnedArray(LoopData) = .{},
     return_block: ?*BasicBlock = null,
@@ -5263,9 +6595,9 @@ const Analyzer = struct{
 
     fn append_instruction(analyzer: *Analyzer, instruction: *Instruction) void {
         assert(!analyzer.current_basic_block.is_terminated);
-        assert(instruction.basic_block == null);
-        instruction.basic_block = analyzer.current_basic_block;
-        _ = analyzer.current_basic_block.instructions.append(instruction);
+        assert(!instruction.is_appended);
+        instruction.is_appended = true;
+        _ = analyzer.current_basic_block.instructions.append(analyzer.arena, instruction);
     }
 };
 
@@ -5307,7 +6639,10 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
     }
 
     const thread = &instance.threads[thread_index];
-    thread.arena = Arena.init(4 * 1024 * 1024) catch unreachable;
+    // Per-node lists overflow into the thread arena, so reserve enough address space for very large programs; pages are only committed on use.
+    // Most threads allocate little here, so it commits in fixed steps without prefaulting. Geometric growth and prefaulting are left to the hot
+    // arrays (functions, basic blocks) that are known to grow big
+    thread.arena = Arena.init(16 * 1024 * 1024 * 1024) catch unreachable;
 
     for (&thread.integers) |*integer| {
         integer.type.sema.thread = @intCast(thread_index);
@@ -5322,8 +6657,9 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
     }
 
     while (true) {
+        const worker_signal = instance.worker_signal.load(.seq_cst);
         while (thread.get_worker_job()) |job| {
-            const c = thread.task_system.job.worker.completed;
+            const job_start = get_instant();
             switch (job.id) {
                 .analyze_file => {
                     if (configuration.timers) {
@@ -5348,7 +6684,9 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                     }
                     const read_start = queue_end;
                     file.state = .reading;
-                    file.source_code = library.read_file(thread.arena, std.fs.cwd(), file.path);
+                    const source_file = get_resident_source(file.path) orelse library.map_file(thread.arena, std.fs.cwd(), file.path);
+                    file.source_code = source_file.bytes;
+                    file.source_is_mapped = source_file.is_mapped;
                     const read_end = get_instant();
                     if (configuration.timers) {
                         file.time.timers.set(.read, .{
@@ -5376,7 +6714,7 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                 assert(interested_file.resolved_import_count != interested_file.imports.length);
                                 for (interested_file.imports.slice(), 0..) |import, i| {
                                     if (import.hash == file_path_hash) {
-                                        const values_per_import = interested_file.values_per_import.get(@enumFromInt(i));
+                                        const values_per_import = interested_file.values_per_import.get(@intCast(i));
                                         for (values_per_import.slice()) |value| {
                                             assert(value.sema.thread == thread.get_index());
                                             assert(!value.sema.resolved);
@@ -5417,8 +6755,8 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                                                                             switch (global_symbol.id) {
                                                                                                 .function_definition => {
                                                                                                     const function_definition = global_symbol.get_payload(.function_definition);
-                                                                                                    const external_fn = function_definition.declaration.clone(thread);
-                                                                                                    
+                                                                                                    const external_fn = get_imported_declaration(thread, &function_definition.declaration);
+
                                                                                                     call.callable = &external_fn.global_symbol.value;
                                                                                                     value.sema.resolved = true;
                                                                                                 },
@@ -5474,7 +6812,9 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                     if (thread.functions.length > 0 or thread.global_variables.length > 0) {
                         const llvm_start = get_instant();
                         const context = LLVM.Context.create();
-                        const module_name: []const u8 = "thread";
+                        // Local symbol GUIDs are derived from the module source file name, so each thread needs its own for ThinLTO
+                        var module_name_buffer: [32]u8 = undefined;
+                        const module_name = std.fmt.bufPrint(&module_name_buffer, "thread{}", .{thread_index}) catch unreachable;
                         const module = LLVM.Module.create(module_name.ptr, module_name.len, context);
                         const builder = LLVM.Builder.create(context);
                         const attributes = LLVM.Attributes{
@@ -5534,19 +6874,16 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                             };
                             break :blk target;
                         };
-                        const jit = false;
-                        const code_model: LLVM.CodeModel = undefined;
-                        const is_code_model_present = false;
-
-                        // TODO:
-                        const codegen_optimization_level: LLVM.CodegenOptimizationLevel = switch (Optimization.none) {
+                        // TODO: FIXME
+                        const unit = instance.units.get_unchecked(0);
+                        const codegen_optimization_level: LLVM.CodegenOptimizationLevel = switch (unit.descriptor.optimization) {
                             .none => .none,
                             .debug_prefer_fast, .debug_prefer_size => .none,
                             .lightly_optimize_for_speed => .less,
                             .optimize_for_speed, .optimize_for_size => .default,
                             .aggressively_optimize_for_speed, .aggressively_optimize_for_size => .aggressive,
                         };
-                        const target_machine = target.createTargetMachine(target_triple.ptr, target_triple.len, cpu.ptr, cpu.len, features.pointer, features.length, LLVM.RelocationModel.static, code_model, is_code_model_present, codegen_optimization_level, jit);
+                        const target_machine = llvm_create_target_machine(target, target_triple, cpu, features.slice(), codegen_optimization_level);
 
                         module.setTargetMachineDataLayout(target_machine);
                         module.setTargetTriple(target_triple.ptr, target_triple.len);
@@ -5559,7 +6896,12 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                             .context = context,
                             .module = module,
                             .attributes = attributes,
+                            .target = target,
                             .target_machine = target_machine,
+                            .target_triple = target_triple,
+                            .cpu = cpu,
+                            .features = features.slice(),
+                            .codegen_optimization_level = codegen_optimization_level,
                             .intrinsic_ids = @TypeOf(thread.llvm.intrinsic_ids).init(.{
                                 .leading_zeroes = llvm_get_intrinsic_id("llvm.ctlz"),
                                 .trailing_zeroes = llvm_get_intrinsic_id("llvm.cttz"),
@@ -5575,7 +6917,7 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                         };
 
                         for (thread.global_strings.values()) |*string| {
-                            string.value.llvm = builder.createGlobalString(string.content.ptr, string.content.len, string.content.ptr, string.content.len, address_space, module).toValue();
+                            string.value.set_llvm(thread, builder.createGlobalString(string.content.ptr, string.content.len, string.content.ptr, string.content.len, address_space, module).toValue());
                         }
 
                         for (thread.external_functions.slice()) |*nat_function| {
@@ -5600,10 +6942,10 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                             const initializer = llvm_get_value(thread, nat_global.initial_value).toConstant() orelse unreachable;
                             const thread_local_mode = LLVM.ThreadLocalMode.not_thread_local;
                             const externally_initialized = false;
-                            const name = thread.identifiers.get(nat_global.global_symbol.global_declaration.declaration.name).?;
+                            const name = instance.identifiers.get_string(nat_global.global_symbol.global_declaration.declaration.name);
                             const global_variable = module.addGlobalVariable(global_type, constant, linkage, initializer, name.ptr, name.len, null, thread_local_mode, address_space, externally_initialized);
                             global_variable.toGlobalObject().setAlignment(nat_global.global_symbol.alignment);
-                            nat_global.global_symbol.value.llvm = global_variable.toValue();
+                            nat_global.global_symbol.value.set_llvm(thread, global_variable.toValue());
 
                             if (thread.generate_debug_information) {
                                 const file_index = nat_global.global_symbol.global_declaration.declaration.scope.file;
@@ -5625,7 +6967,7 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                         }
 
                         for (thread.functions.slice()) |*nat_function| {
-                            const function = nat_function.declaration.global_symbol.value.llvm.?.toFunction() orelse unreachable;
+                            const function = nat_function.declaration.global_symbol.value.get_llvm(thread).?.toFunction() orelse unreachable;
                             const file_index = nat_function.declaration.global_symbol.global_declaration.declaration.scope.file;
                             var basic_block_command_buffer = BasicBlock.CommandList{};
                             var emit_allocas = true;
@@ -5634,7 +6976,7 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                 assert(nat_entry_basic_block.predecessors.length == 0);
                                 const entry_block_name = "entry";
                                 const entry_block = thread.llvm.context.createBasicBlock(entry_block_name, entry_block_name.len, function, null);
-                                nat_entry_basic_block.value.llvm = entry_block.toValue();
+                                nat_entry_basic_block.value.set_llvm(thread, entry_block.toValue());
 
                                 basic_block_command_buffer.append(&nat_entry_basic_block.command_node);
                             }
@@ -5645,7 +6987,7 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                             while (basic_block_command_buffer.len != 0) {
                                 const basic_block_node = basic_block_command_buffer.first orelse unreachable;
                                 const basic_block: *BasicBlock = @fieldParentPtr("command_node", basic_block_node);
-                                const llvm_basic_block = basic_block.get_llvm();
+                                const llvm_basic_block = basic_block.get_llvm(thread);
                                 builder.setInsertPoint(llvm_basic_block);
 
                                 var last_block = basic_block_node;
@@ -5656,11 +6998,11 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                         switch (argument.instruction.id) {
                                             .argument_storage => {
                                                 const alloca_type = llvm_get_type(thread, argument.type);
-                                                argument.instruction.value.llvm = builder.createAlloca(alloca_type, address_space, null, "", "".len, argument.alignment).toValue();
+                                                argument.instruction.value.set_llvm(thread, builder.createAlloca(alloca_type, address_space, null, "", "".len, argument.alignment).toValue());
                                             },
                                             .abi_indirect_argument => {
                                                 const llvm_argument = function.getArgument(argument.index);
-                                                argument.instruction.value.llvm = llvm_argument.toValue();
+                                                argument.instruction.value.set_llvm(thread, llvm_argument.toValue());
                                             },
                                             else => |t| @panic(@tagName(t)),
                                         }
@@ -5668,17 +7010,22 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
 
                                     for (nat_function.stack_slots.slice()) |local_slot| {
                                         const alloca_type = llvm_get_type(thread, local_slot.type);
-                                        local_slot.instruction.value.llvm = builder.createAlloca(alloca_type, address_space, null, "", "".len, local_slot.alignment).toValue();
+                                        local_slot.instruction.value.set_llvm(thread, builder.createAlloca(alloca_type, address_space, null, "", "".len, local_slot.alignment).toValue());
                                     }
 
                                     emit_allocas = false;
                                 }
 
+                                // Consecutive instructions of a statement share their location, so only talk to LLVM when it changes
+                                var current_debug_location: u32 = std.math.maxInt(u32);
+
                                 for (basic_block.instructions.slice()) |instruction| {
-                                    if (thread.generate_debug_information) {
-                                        if (instruction.line != 0) {
-                                            const scope = llvm_get_scope(thread, instruction.scope);
-                                            builder.setCurrentDebugLocation(context, instruction.line, instruction.column, scope, function);
+                                    if (thread.generate_debug_information and instruction.debug_location != current_debug_location) {
+                                        current_debug_location = instruction.debug_location;
+                                        const location = thread.debug_locations.get_unchecked(current_debug_location);
+                                        if (location.line != 0) {
+                                            const scope = llvm_get_scope(thread, location.scope);
+                                            builder.setCurrentDebugLocation(context, location.line, location.column, scope, function);
                                         } else {
                                             builder.clearCurrentDebugLocation();
                                         }
@@ -5696,9 +7043,9 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                             const argument_symbol = debug_argument.argument;
                                             const name_hash = argument_symbol.argument_declaration.declaration.name;
                                             assert(name_hash != 0);
-                                            const name = thread.identifiers.get(name_hash).?;
+                                            const name = instance.identifiers.get_string(name_hash);
                                             const file_struct = llvm_get_file(thread, file_index);
-                                            const scope = llvm_get_scope(thread, instruction.scope);
+                                            const scope = llvm_get_scope(thread, thread.debug_locations.get_unchecked(instruction.debug_location).scope);
 
                                             const debug_declaration_type = llvm_get_debug_type(thread, file_struct.builder, argument_symbol.type);
                                             const always_preserve = true;
@@ -5735,7 +7082,7 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                             const line = argument_symbol.argument_declaration.declaration.line;
                                             const column = argument_symbol.argument_declaration.declaration.column;
                                             const debug_parameter_variable = file_struct.builder.createParameterVariable(scope, name.ptr, name.len, argument_index, file_struct.file, line, debug_declaration_type, always_preserve, flags);
-                                            const argument_alloca = argument_symbol.instruction.value.llvm.?;
+                                            const argument_alloca = argument_symbol.instruction.value.get_llvm(thread).?;
 
                                             const insert_declare = file_struct.builder.insertDeclare(argument_alloca, debug_parameter_variable, context, line, column, function.getSubprogram().toLocalScope().toScope(), builder.getInsertBlock());
                                             break :block insert_declare.toValue();
@@ -5778,13 +7125,13 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                             };
 
                                             const alignment = 0;
-                                            const declaration_name = thread.identifiers.get(local_symbol.local_declaration.declaration.name).?;
+                                            const declaration_name = instance.identifiers.get_string(local_symbol.local_declaration.declaration.name);
                                             const line = local_symbol.local_declaration.declaration.line;
                                             const column = local_symbol.local_declaration.declaration.column;
                                             const scope = llvm_get_scope(thread, local_symbol.local_declaration.declaration.scope);
                                             const debug_local_variable = file.builder.createAutoVariable(scope, declaration_name.ptr, declaration_name.len, file.file, line, debug_declaration_type, always_preserve, flags, alignment);
 
-                                            const insert_declare = file.builder.insertDeclare(local_symbol.instruction.value.llvm.?, debug_local_variable, context, line, column, (function.getSubprogram()).toLocalScope().toScope(), builder.getInsertBlock());
+                                            const insert_declare = file.builder.insertDeclare(local_symbol.instruction.value.get_llvm(thread).?, debug_local_variable, context, line, column, (function.getSubprogram()).toLocalScope().toScope(), builder.getInsertBlock());
                                             break :block insert_declare.toValue();
                                         },
                                         .store => block: {
@@ -5899,11 +7246,11 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                             last_block = &branch.not_taken.command_node;
 
                                             const taken = thread.llvm.context.createBasicBlock("", "".len, function, null);
-                                            branch.taken.value.llvm = taken.toValue();
+                                            branch.taken.value.set_llvm(thread, taken.toValue());
                                             assert(taken.toValue().toBasicBlock() != null);
                                             const not_taken = thread.llvm.context.createBasicBlock("", "".len, function, null);
                                             assert(not_taken.toValue().toBasicBlock() != null);
-                                            branch.not_taken.value.llvm = not_taken.toValue();
+                                            branch.not_taken.value.set_llvm(thread, not_taken.toValue());
 
                                             const condition = llvm_get_value(thread, branch.condition);
                                             const branch_weights = null;
@@ -5915,10 +7262,10 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                             const jump = instruction.get_payload(.jump);
                                             const target_block = jump.basic_block;
                                             assert(target_block.value.sema.thread == thread.get_index());
-                                            const llvm_target_block = if (target_block.value.llvm) |llvm| llvm.toBasicBlock() orelse unreachable else bb: {
+                                            const llvm_target_block = if (target_block.value.get_llvm(thread)) |llvm| llvm.toBasicBlock() orelse unreachable else bb: {
                                                 const block = thread.llvm.context.createBasicBlock("", "".len, function, null);
                                                 assert(block.toValue().toBasicBlock() != null);
-                                                target_block.value.llvm = block.toValue();
+                                                target_block.value.set_llvm(thread, block.toValue());
                                                 basic_block_command_buffer.insertAfter(last_block, &target_block.command_node);
                                                 last_block = &target_block.command_node;
                                                 break :bb block;
@@ -6026,132 +7373,958 @@ fn worker_thread(thread_index: u32, cpu_count: *u32) void {
                                         else => |t| @panic(@tagName(t)),
                                     };
 
-                                    instruction.value.llvm = value;
-                                }
+                                    instruction.value.set_llvm(thread, value);
+                                }
+
+                                _ = basic_block_command_buffer.popFirst();
+                            }
+
+                            for (phis.const_slice(), llvm_phi_nodes.const_slice()) |phi, llvm_phi| {
+                                for (phi.nodes.const_slice()) |phi_node| {
+                                    const llvm_value = llvm_get_value(thread, phi_node.value);
+                                    const llvm_basic_block = phi_node.basic_block.get_llvm(thread);
+                                    llvm_phi.addIncoming(llvm_value, llvm_basic_block);
+                                }
+                            }
+
+                            if (thread.generate_debug_information) {
+                                const llvm_file = thread.debug_info_file_map.get_pointer(file_index).?;
+                                const subprogram = function.getSubprogram();
+                                llvm_file.builder.finalizeSubprogram(subprogram, function);
+                            }
+
+                            const verify_function = false;
+                            if (verify_function) {
+                                var message: []const u8 = undefined;
+                                const verification_success = function.verify(&message.ptr, &message.len);
+                                if (!verification_success) {
+                                    var function_msg: []const u8 = undefined;
+                                    function.toString(&function_msg.ptr, &function_msg.len);
+                                    write(function_msg);
+                                    write("\n");
+                                    fail_message(message);
+                                }
+                            }
+                        }
+
+                        if (thread.generate_debug_information) {
+                            for (thread.debug_info_file_map.values()) |v| {
+                                v.builder.finalize();
+                            }
+                        }
+
+                        const verify_module = builtin.mode == .Debug;
+                        const print_module_at_failure = true;
+                        const print_module = false;
+
+                        if (verify_module) {
+                            var verification_message: []const u8 = undefined;
+                            const verification_success = thread.llvm.module.verify(&verification_message.ptr, &verification_message.len);
+                            if (!verification_success) {
+                                if (print_module_at_failure) {
+                                    var module_content: []const u8 = undefined;
+                                    thread.llvm.module.toString(&module_content.ptr, &module_content.len);
+                                    write(module_content);
+                                    write("\n");
+                                }
+
+                                fail_message(verification_message);
+                            }
+                        }
+
+                        if (print_module) {
+                            var module_content: []const u8 = undefined;
+                            thread.llvm.module.toString(&module_content.ptr, &module_content.len);
+                            write(module_content);
+                            write("\n");
+                        }
+
+                        const llvm_end = get_instant();
+
+                        if (configuration.timers) {
+                            thread.time.timers.set(.llvm_build_ir, .{
+                                .start = llvm_start,
+                                .end = llvm_end,
+                            });
+                        }
+
+                        const function_batch_size = unit.descriptor.codegen_backend.llvm.function_batch_size;
+                        // ThinLTO already spreads the backend work over threads inside the linker
+                        const partition_count: u32 = if (function_batch_size == 0 or unit.descriptor.codegen_backend.llvm.lto == .thin) 1 else b: {
+                            // Partitions are made of the functions the module defines; declarations of imported functions don't count
+                            const defined_function_count = thread.llvm.module.getDefinedFunctionCount();
+                            break :b @max(std.math.divCeil(u32, defined_function_count, function_batch_size) catch unreachable, 1);
+                        };
+
+                        if (partition_count > 1) {
+                            // The module is split by function so that the optimization and codegen of a big thread module are spread over every idle thread,
+                            // no matter which thread analyzed the files
+                            llvm_split_into_partitions(thread, partition_count, false);
+                        } else {
+                            thread.add_control_work(.{
+                                .id = .llvm_notify_ir_done,
+                            });
+                        }
+                    }
+                },
+                .llvm_optimize => {
+                    const llvm_start = get_instant();
+                    // TODO: FIXME
+                    const unit = instance.units.get_unchecked(0);
+                    const optimization_level = llvm_get_optimization_level(unit.descriptor.optimization);
+                    const thin_lto = unit.descriptor.codegen_backend.llvm.lto == .thin;
+                    thread.llvm.module.runOptimizationPipeline(thread.llvm.target_machine, optimization_level, thin_lto, false);
+
+                    const llvm_end = get_instant();
+
+                    if (configuration.timers) {
+                        thread.time.timers.set(.llvm_optimize, .{
+                            .start = llvm_start,
+                            .end = llvm_end,
+                        });
+                    }
+
+                    thread.add_control_work(.{
+                        .id = .llvm_notify_optimize_done,
+                    });
+                },
+                .llvm_emit_object => {
+                    const llvm_start = get_instant();
+                    // TODO: FIXME
+                    const unit = instance.units.get_unchecked(0);
+                    const thin_lto = unit.descriptor.codegen_backend.llvm.lto == .thin;
+                    // Splitting the optimized module only spreads machine code emission. The pieces are emitted by whichever threads are idle,
+                    // so a thread module never fans out into threads of its own
+                    const partition_count = if (thin_lto) 1 else @min(unit.descriptor.codegen_backend.llvm.codegen_partition_count, thread.llvm.module.getDefinedFunctionCount());
+
+                    if (partition_count > 1) {
+                        llvm_split_into_partitions(thread, partition_count, true);
+                    } else {
+                        const timestamp = get_instant();
+                        const extension = if (thin_lto) "bc" else "o";
+                        const thread_object = std.fmt.allocPrint(std.heap.page_allocator, "nat/o/{s}_thread{}_{}.{s}", .{std.fs.path.basename(std.fs.path.dirname(instance.files.get(@enumFromInt(0)).path).?), thread.get_index(), timestamp, extension}) catch unreachable;
+                        if (thin_lto) {
+                            const bitcode_objects = thread.arena.new_array([]const u8, 1) catch unreachable;
+                            bitcode_objects[0] = thread_object;
+                            thread.llvm.objects = .{
+                                .paths = bitcode_objects,
+                            };
+
+                            const result = thread.llvm.module.writeThinLTOBitcode(thread_object.ptr, thread_object.len);
+                            if (!result) {
+                                @panic("can't write bitcode");
+                            }
+                        } else {
+                            thread.llvm.objects = llvm_emit_object_cached(thread, thread, unit, thread.llvm.module, thread.llvm.target_machine, thread_object);
+                        }
+
+                        const llvm_end = get_instant();
+
+                        if (configuration.timers) {
+                            thread.time.timers.set(.llvm_emit_object, .{
+                                .start = llvm_start,
+                                .end = llvm_end,
+                            });
+                        }
+
+                        thread.add_control_work(.{
+                            .id = .llvm_notify_object_done,
+                        });
+                        // std.debug.print("Thread #{} emitted object and notified\n", .{thread_index});
+                    }
+                },
+                .llvm_emit_partition => {
+                    const owner = &instance.threads[job.count];
+                    const partition = &owner.llvm.partitions[job.offset];
+                    // TODO: FIXME
+                    const unit = instance.units.get_unchecked(0);
+
+                    // Target machines can't be shared between threads, so every partition gets its own
+                    const target_machine = llvm_create_target_machine(owner.llvm.target, owner.llvm.target_triple, owner.llvm.cpu, owner.llvm.features, owner.llvm.codegen_optimization_level);
+                    if (!partition.optimized and unit.descriptor.optimization != .none) {
+                        partition.module.runOptimizationPipeline(target_machine, llvm_get_optimization_level(unit.descriptor.optimization), false, false);
+                    }
+
+                    const timestamp = get_instant();
+                    const partition_object = std.fmt.allocPrint(std.heap.page_allocator, "nat/o/{s}_thread{}_partition{}_{}.o", .{std.fs.path.basename(std.fs.path.dirname(instance.files.get(@enumFromInt(0)).path).?), owner.get_index(), job.offset, timestamp}) catch unreachable;
+                    partition.objects = llvm_emit_object_cached(thread, owner, unit, partition.module, target_machine, partition_object);
+                    partition.module.disposePartition();
+                    thread.emitted_partition_count += 1;
+
+                    _ = @atomicRmw(u32, &owner.llvm.pending_partitions, .Sub, 1, .acq_rel);
+                },
+                .compile_c_source_file => {
+                    // TODO: FIXME
+                    const unit = instance.units.get_unchecked(0);
+                    const c_source_file_index = job.offset;
+                    const source_file = unit.descriptor.c_source_files[c_source_file_index];
+                    const object_path = unit.descriptor.c_object_files[c_source_file_index];
+                    const precompiled_header = get_c_precompiled_header(thread, unit);
+                    var argument_buffer = std.BoundedArray([]const u8, 16){};
+                    const arguments = get_c_source_file_arguments(&argument_buffer, source_file, object_path, precompiled_header);
+                    const flags_hash = CObjectCache.get_flags_hash(arguments);
+
+                    thread.c_object_lookups += 1;
+                    if (CObjectCache.is_up_to_date(object_path, flags_hash)) {
+                        thread.c_object_reuses += 1;
+                    } else {
+                        compile_c_source_files(thread, arguments, null);
+                        CObjectCache.write(object_path, flags_hash);
+                    }
+                },
+                .compile_c_source_batch => {
+                    // TODO: FIXME
+                    const unit = instance.units.get_unchecked(0);
+                    const batch = &unit.c_batch;
+                    const precompiled_header = get_c_precompiled_header(thread, unit);
+                    const source_files = unit.descriptor.c_source_files[job.offset..][0..job.count];
+                    const object_files = unit.descriptor.c_object_files[job.offset..][0..job.count];
+                    for (source_files, object_files) |source_file, object_path| {
+                        var argument_buffer = std.BoundedArray([]const u8, 16){};
+                        const arguments = get_c_source_file_arguments(&argument_buffer, source_file, object_path, precompiled_header);
+                        const flags_hash = CObjectCache.get_flags_hash(arguments);
+
+                        thread.c_object_lookups += 1;
+                        if (CObjectCache.is_up_to_date(object_path, flags_hash)) {
+                            thread.c_object_reuses += 1;
+                        } else {
+                            compile_c_source_files(thread, arguments, batch);
+                            _ = batch.compiled_objects.append(.{
+                                .object_path = object_path,
+                                .flags_hash = flags_hash,
+                            });
+                        }
+                    }
+
+                    const file_count = batch.argcs.length;
+                    if (file_count > 0) {
+                        batch.handle = nat_clang_batch_create(batch.argvs.pointer, batch.argcs.pointer, file_count, @intCast(instance.threads.len));
+
+                        if (nat_clang_batch_is_serial(batch.handle.?)) {
+                            for (0..file_count) |file_index| {
+                                batch.compile(@intCast(file_index), thread.get_index());
+                            }
+                        } else {
+                            // Every file is a job of its own, so the files are spread over whichever threads are idle instead of
+                            // over threads of the batch's own
+                            _ = @atomicRmw(u32, &batch.pending_count, .Add, file_count, .acq_rel);
+
+                            for (0..file_count) |file_index| {
+                                thread.add_owned_work(.{
+                                    .id = .compile_c_source_batch_file,
+                                    .offset = @intCast(file_index),
+                                    .count = 1,
+                                });
+                            }
+                        }
+                    }
+
+                    batch.complete_pending();
+                },
+                .compile_c_source_batch_file => {
+                    // TODO: FIXME
+                    const unit = instance.units.get_unchecked(0);
+                    const batch = &unit.c_batch;
+                    batch.compile(job.offset, thread.get_index());
+                    batch.complete_pending();
+                },
+                else => |t| @panic(@tagName(t)),
+            }
+
+            if (configuration.timers) {
+                _ = thread.stage_spans.append(.{
+                    .stage = Thread.Stage.from_job(job.id),
+                    .start = job_start,
+                    .end = get_instant(),
+                });
+            }
+
+            thread.complete_worker_job();
+        }
+
+        thread.try_notify_analysis_complete();
+
+        signal_wait(&instance.worker_signal, worker_signal, 1000);
+    }
+}
+
+const object_cache_directory = "nat/cache/o";
+const link_cache_directory = "nat/cache/link";
+const dependency_graph_directory = "nat/cache/deps";
+const precompiled_header_cache_directory = "nat/cache/pch";
+
+// Key of the inputs of the last successful link of an output. When neither the inputs nor the output changed since, linking again
+// would produce the same file, so the link is skipped. Objects from the object cache are named after their content, so their path
+// identifies them; any other input (objects, crt objects, the libraries found on the search paths and the files their linker scripts
+// name) is identified by its path and file metadata
+const LinkCache = struct{
+    const Record = extern struct{
+        key: [32]u8,
+        output_size: u64,
+        output_modification_time: i64,
+    };
+
+    fn get_path(options: LinkerOptions) []const u8 {
+        const output_path_hash = std.hash.Wyhash.hash(0, options.output_file_path);
+        return std.fmt.allocPrint(std.heap.page_allocator, "{s}/{x:0>16}.link", .{link_cache_directory, output_path_hash}) catch unreachable;
+    }
+
+    fn hash_string(hasher: *std.crypto.hash.Blake3, string: []const u8) void {
+        hasher.update(std.mem.asBytes(&string.len));
+        hasher.update(string);
+    }
+
+    // Covers the whole command line link() passes, including the crt objects, libraries and search paths it adds on its own
+    fn get_key(options: LinkerOptions) [32]u8 {
+        const arguments = get_link_arguments(options);
+        var hasher = std.crypto.hash.Blake3.init(.{});
+        for (arguments.argv.const_slice()) |argument| {
+            hash_string(&hasher, argument);
+        }
+
+        for (arguments.inputs.const_slice()) |argument_index| {
+            const input = arguments.argv.pointer[argument_index];
+            if (!library.starts_with_slice(input, object_cache_directory)) {
+                // A library that can't be found is part of the key through its name only, LLD reports it
+                if (arguments.resolve_input(input)) |path| {
+                    hash_input_file(&hasher, &arguments, path);
+                }
+            }
+        }
+
+        for (arguments.buffers.const_slice()) |buffer| {
+            const buffer_hash = std.hash.Wyhash.hash(0, buffer);
+            hasher.update(std.mem.asBytes(&buffer_hash));
+        }
+
+        var key: [32]u8 = undefined;
+        hasher.final(&key);
+        return key;
+    }
+
+    fn hash_input_file(hasher: *std.crypto.hash.Blake3, arguments: *const LinkArguments, path: []const u8) void {
+        hash_string(hasher, path);
+        const file = std.fs.cwd().openFile(path, .{}) catch return;
+        defer file.close();
+        const stat = file.stat() catch return;
+        hasher.update(std.mem.asBytes(&stat.inode));
+        hasher.update(std.mem.asBytes(&stat.size));
+        hasher.update(std.mem.asBytes(&stat.mtime));
+
+        // The files a linker script pulls in are inputs as well. libc.so stays the same when the libc.so.6 it names is updated
+        var magic: [8]u8 = undefined;
+        const magic_length = file.readAll(&magic) catch return;
+        if (library.starts_with_slice(magic[0..magic_length], "!<thin>\n")) {
+            file.seekTo(0) catch return;
+            const bytes = file.readToEndAlloc(std.heap.page_allocator, std.math.maxInt(u32)) catch return;
+            for (get_thin_archive_members(path, bytes)) |member_path| {
+                hash_input_file(hasher, arguments, member_path);
+            }
+        } else if (LinkerScriptTokenizer.is_script(magic[0..magic_length])) {
+            file.seekTo(0) catch return;
+            const bytes = file.readToEndAlloc(std.heap.page_allocator, std.math.maxInt(u32)) catch return;
+            var tokenizer = LinkerScriptTokenizer{ .bytes = bytes };
+            while (tokenizer.next()) |token| {
+                if (library.starts_with_slice(token, "-l") or token[0] == '/') {
+                    if (arguments.resolve_input(token)) |named_path| {
+                        hash_input_file(hasher, arguments, named_path);
+                    }
+                }
+            }
+        }
+    }
+
+    fn is_up_to_date(options: LinkerOptions, key: [32]u8) bool {
+        const bytes = std.fs.cwd().readFileAlloc(std.heap.page_allocator, get_path(options), @sizeOf(Record)) catch return false;
+        defer std.heap.page_allocator.free(bytes);
+
+        if (bytes.len != @sizeOf(Record)) return false;
+        const record = std.mem.bytesToValue(Record, bytes[0..@sizeOf(Record)]);
+        // The output may have been deleted or rewritten by someone else since
+        const stat = std.fs.cwd().statFile(options.output_file_path) catch return false;
+        const modification_time: i64 = @truncate(stat.mtime);
+
+        return byte_equal(&record.key, &key) and record.output_size == stat.size and record.output_modification_time == modification_time;
+    }
+
+    fn write(options: LinkerOptions, key: [32]u8) void {
+        const stat = std.fs.cwd().statFile(options.output_file_path) catch return;
+        const record = Record{
+            .key = key,
+            .output_size = stat.size,
+            .output_modification_time = @truncate(stat.mtime),
+        };
+
+        std.fs.cwd().makePath(link_cache_directory) catch unreachable;
+        const record_path = get_path(options);
+        const temporary_path = std.fmt.allocPrint(std.heap.page_allocator, "{s}.tmp", .{record_path}) catch unreachable;
+        std.fs.cwd().writeFile(.{ .sub_path = temporary_path, .data = std.mem.asBytes(&record) }) catch unreachable;
+        std.fs.cwd().rename(temporary_path, record_path) catch unreachable;
+    }
+};
+
+// Manifest of the inputs of a C object: a hash of its command line plus the source and every header it included, as listed in the
+// depfile clang writes next to the object. While neither the flags nor any input changed, the object is reused as is
+const CObjectCache = struct{
+    const magic: u32 = 0x6f63_616e;
+    const version: u32 = 1;
+
+    const Header = extern struct{
+        magic: u32,
+        version: u32,
+        flags_hash: u64,
+        file_count: u32,
+        path_byte_count: u32,
+    };
+
+    const Compiled = struct{
+        object_path: []const u8,
+        flags_hash: u64,
+    };
+
+    fn get_manifest_path(object_path: []const u8) []const u8 {
+        return std.fmt.allocPrint(std.heap.page_allocator, "{s}.manifest", .{object_path}) catch unreachable;
+    }
+
+    fn get_depfile_path(object_path: []const u8) []const u8 {
+        return std.fmt.allocPrint(std.heap.page_allocator, "{s}.d", .{object_path}) catch unreachable;
+    }
+
+    fn get_flags_hash(arguments: []const []const u8) u64 {
+        var hasher = std.hash.Wyhash.init(0);
+        for (arguments) |argument| {
+            hasher.update(std.mem.asBytes(&argument.len));
+            hasher.update(argument);
+        }
+
+        // The rest of the command line is fixed by the compiler binary
+        const compiler_stat = std.fs.cwd().statFile(instance.paths.executable) catch unreachable;
+        const compiler_modification_time: i64 = @truncate(compiler_stat.mtime);
+        hasher.update(std.mem.asBytes(&compiler_modification_time));
+
+        return hasher.final();
+    }
+
+    const Manifest = struct{
+        header: Header,
+        file_entries: []align(1) const DependencyGraph.FileEntry,
+        paths: []const u8,
+    };
+
+    fn read(object_path: []const u8) ?Manifest {
+        const bytes = std.fs.cwd().readFileAlloc(std.heap.page_allocator, get_manifest_path(object_path), std.math.maxInt(u32)) catch return null;
+
+        if (bytes.len < @sizeOf(Header)) return null;
+        const header = std.mem.bytesToValue(Header, bytes[0..@sizeOf(Header)]);
+        if (header.magic != magic or header.version != version) return null;
+
+        const files_offset = @sizeOf(Header);
+        const paths_offset = files_offset + @as(usize, header.file_count) * @sizeOf(DependencyGraph.FileEntry);
+        if (bytes.len != paths_offset + header.path_byte_count) return null;
+
+        const file_entries = std.mem.bytesAsSlice(DependencyGraph.FileEntry, bytes[files_offset..paths_offset]);
+        // A damaged manifest means a recompile, never a crash
+        for (file_entries) |file_entry| {
+            if (@as(u64, file_entry.path_offset) + file_entry.path_length > header.path_byte_count) return null;
+        }
+
+        return .{
+            .header = header,
+            .file_entries = file_entries,
+            .paths = bytes[paths_offset..],
+        };
+    }
+
+    fn is_up_to_date(object_path: []const u8, flags_hash: u64) bool {
+        std.fs.cwd().access(object_path, .{}) catch return false;
+        const manifest = read(object_path) orelse return false;
+        if (manifest.header.flags_hash != flags_hash) return false;
+
+        for (manifest.file_entries) |file_entry| {
+            const path = manifest.paths[file_entry.path_offset..][0..file_entry.path_length];
+            if (DependencyGraph.is_file_changed(path, file_entry)) return false;
+        }
+
+        return true;
+    }
+
+    fn write(object_path: []const u8, flags_hash: u64) void {
+        const depfile = std.fs.cwd().readFileAlloc(std.heap.page_allocator, get_depfile_path(object_path), std.math.maxInt(u32)) catch return;
+        defer std.heap.page_allocator.free(depfile);
+
+        var file_entries = PinnedArray(DependencyGraph.FileEntry){};
+        var paths = PinnedArray(u8){};
+
+        var iterator = DepfileIterator{ .bytes = depfile };
+        while (iterator.next()) |dependency| {
+            const content = std.fs.cwd().readFileAlloc(std.heap.page_allocator, dependency, std.math.maxInt(u32)) catch return;
+            defer std.heap.page_allocator.free(content);
+            DependencyGraph.append_file(&file_entries, &paths, dependency, content);
+        }
+
+        const header = Header{
+            .magic = magic,
+            .version = version,
+            .flags_hash = flags_hash,
+            .file_count = file_entries.length,
+            .path_byte_count = paths.length,
+        };
+
+        const manifest_path = get_manifest_path(object_path);
+        const temporary_path = std.fmt.allocPrint(std.heap.page_allocator, "{s}.tmp", .{manifest_path}) catch unreachable;
+        {
+            const manifest_file = std.fs.cwd().createFile(temporary_path, .{}) catch unreachable;
+            defer manifest_file.close();
+            manifest_file.writeAll(std.mem.asBytes(&header)) catch unreachable;
+            manifest_file.writeAll(std.mem.sliceAsBytes(file_entries.const_slice())) catch unreachable;
+            manifest_file.writeAll(paths.const_slice()) catch unreachable;
+        }
+        std.fs.cwd().rename(temporary_path, manifest_path) catch unreachable;
+    }
 
-                                _ = basic_block_command_buffer.popFirst();
-                            }
+    fn append_file_entries(object_path: []const u8, file_entries: *PinnedArray(DependencyGraph.FileEntry), paths: *PinnedArray(u8)) void {
+        const manifest = read(object_path) orelse return;
+        for (manifest.file_entries) |file_entry| {
+            const path = manifest.paths[file_entry.path_offset..][0..file_entry.path_length];
+            var entry = file_entry;
+            entry.path_offset = paths.length;
+            _ = file_entries.append(entry);
+            paths.append_slice(path);
+        }
+    }
+};
 
-                            for (phis.const_slice(), llvm_phi_nodes.const_slice()) |phi, llvm_phi| {
-                                for (phi.nodes.const_slice()) |phi_node| {
-                                    const llvm_value = llvm_get_value(thread, phi_node.value);
-                                    const llvm_basic_block = phi_node.basic_block.get_llvm();
-                                    llvm_phi.addIncoming(llvm_value, llvm_basic_block);
-                                }
-                            }
+// Precompiled prefix header shared by the C source files of a unit. It is keyed by the header contents, the flags it is compiled
+// with and the compiler binary (the format is tied to the clang linked into it), and stored together with the depfile of its
+// compilation so that a change in any header it transitively includes is noticed on the next build
+const PrecompiledHeaderCache = struct{
+    fn get_key(header_path: []const u8) [32]u8 {
+        var hasher = std.crypto.hash.Blake3.init(.{});
+        LinkCache.hash_string(&hasher, header_path);
 
-                            if (thread.generate_debug_information) {
-                                const llvm_file = thread.debug_info_file_map.get_pointer(file_index).?;
-                                const subprogram = function.getSubprogram();
-                                llvm_file.builder.finalizeSubprogram(subprogram, function);
-                            }
+        const content = std.fs.cwd().readFileAlloc(std.heap.page_allocator, header_path, std.math.maxInt(u32)) catch fail_term("Unable to read C prefix header", header_path);
+        defer std.heap.page_allocator.free(content);
+        LinkCache.hash_string(&hasher, content);
 
-                            const verify_function = false;
-                            if (verify_function) {
-                                var message: []const u8 = undefined;
-                                const verification_success = function.verify(&message.ptr, &message.len);
-                                if (!verification_success) {
-                                    var function_msg: []const u8 = undefined;
-                                    function.toString(&function_msg.ptr, &function_msg.len);
-                                    write(function_msg);
-                                    write("\n");
-                                    fail_message(message);
-                                }
-                            }
-                        }
+        for (c_source_file_flags) |flag| {
+            LinkCache.hash_string(&hasher, flag);
+        }
 
-                        if (thread.generate_debug_information) {
-                            for (thread.debug_info_file_map.values()) |v| {
-                                v.builder.finalize();
-                            }
-                        }
+        const compiler_stat = std.fs.cwd().statFile(instance.paths.executable) catch unreachable;
+        hasher.update(std.mem.asBytes(&compiler_stat.size));
+        hasher.update(std.mem.asBytes(&compiler_stat.mtime));
 
-                        const verify_module = builtin.mode == .Debug;
-                        const print_module_at_failure = true;
-                        const print_module = false;
+        var key: [32]u8 = undefined;
+        hasher.final(&key);
+        return key;
+    }
 
-                        if (verify_module) {
-                            var verification_message: []const u8 = undefined;
-                            const verification_success = thread.llvm.module.verify(&verification_message.ptr, &verification_message.len);
-                            if (!verification_success) {
-                                if (print_module_at_failure) {
-                                    var module_content: []const u8 = undefined;
-                                    thread.llvm.module.toString(&module_content.ptr, &module_content.len);
-                                    write(module_content);
-                                    write("\n");
-                                }
+    fn is_up_to_date(precompiled_header_path: []const u8, depfile_path: []const u8) bool {
+        const precompiled_header_stat = std.fs.cwd().statFile(precompiled_header_path) catch return false;
+        const depfile = std.fs.cwd().readFileAlloc(std.heap.page_allocator, depfile_path, std.math.maxInt(u32)) catch return false;
+        defer std.heap.page_allocator.free(depfile);
 
-                                fail_message(verification_message);
-                            }
-                        }
+        var iterator = DepfileIterator{ .bytes = depfile };
+        while (iterator.next()) |dependency| {
+            const dependency_stat = std.fs.cwd().statFile(dependency) catch return false;
+            if (dependency_stat.mtime > precompiled_header_stat.mtime) return false;
+        }
 
-                        if (print_module) {
-                            var module_content: []const u8 = undefined;
-                            thread.llvm.module.toString(&module_content.ptr, &module_content.len);
-                            write(module_content);
-                            write("\n");
-                        }
+        return true;
+    }
 
-                        const llvm_end = get_instant();
+    fn get(thread: *Thread, header_path: []const u8) []const u8 {
+        const key = get_key(header_path);
+        const key_hex = std.fmt.bytesToHex(key, .lower);
+        const precompiled_header_path = std.fmt.allocPrint(std.heap.page_allocator, "{s}/{s}.pch", .{precompiled_header_cache_directory, key_hex}) catch unreachable;
+        const depfile_path = std.fmt.allocPrint(std.heap.page_allocator, "{s}/{s}.d", .{precompiled_header_cache_directory, key_hex}) catch unreachable;
 
-                        if (configuration.timers) {
-                            thread.time.timers.set(.llvm_build_ir, .{
-                                .start = llvm_start,
-                                .end = llvm_end,
-                            });
-                        }
+        if (!is_up_to_date(precompiled_header_path, depfile_path)) {
+            std.fs.cwd().makePath(precompiled_header_cache_directory) catch unreachable;
+            const temporary_precompiled_header_path = std.fmt.allocPrint(std.heap.page_allocator, "{s}.tmp", .{precompiled_header_path}) catch unreachable;
+            const temporary_depfile_path = std.fmt.allocPrint(std.heap.page_allocator, "{s}.tmp", .{depfile_path}) catch unreachable;
 
-                        thread.add_control_work(.{
-                            .id = .llvm_notify_ir_done,
-                        });
-                    }
-                },
-                .llvm_emit_object => {
-                    const llvm_start = get_instant();
-                    const timestamp = get_instant();
-                    const thread_object = std.fmt.allocPrint(std.heap.page_allocator, "nat/o/{s}_thread{}_{}.o", .{std.fs.path.basename(std.fs.path.dirname(instance.files.get(@enumFromInt(0)).path).?), thread.get_index(), timestamp}) catch unreachable;
-                    thread.llvm.object = thread_object;
-                    const disable_verify = builtin.mode != .Debug;
-                    const result = thread.llvm.module.addPassesToEmitFile(thread.llvm.target_machine, thread_object.ptr, thread_object.len, LLVM.CodeGenFileType.object, disable_verify);
-                    if (!result) {
-                        @panic("can't generate machine code");
-                    }
+            const arguments = [_][]const u8{ "-c", header_path, "-o", temporary_precompiled_header_path, "-MD", "-MF", temporary_depfile_path } ++ c_source_file_flags;
+            compile_c_source_files(thread, &arguments, null);
 
-                    const llvm_end = get_instant();
+            // The depfile goes first: a precompiled header without one is never considered up to date
+            std.fs.cwd().rename(temporary_depfile_path, depfile_path) catch unreachable;
+            std.fs.cwd().rename(temporary_precompiled_header_path, precompiled_header_path) catch unreachable;
+        }
 
-                    if (configuration.timers) {
-                        thread.time.timers.set(.llvm_emit_object, .{
-                            .start = llvm_start,
-                            .end = llvm_end,
-                        });
-                    }
+        return precompiled_header_path;
+    }
+};
 
-                    thread.add_control_work(.{
-                        .id = .llvm_notify_object_done,
-                    });
-                    // std.debug.print("Thread #{} emitted object and notified\n", .{thread_index});
-                },
-                .compile_c_source_file => {
-                    // TODO: FIXME
-                    const unit = instance.units.get_unchecked(0);
-                    const c_source_file_index = job.offset;
-                    const source_file = unit.descriptor.c_source_files[c_source_file_index];
-                    const object_path = unit.descriptor.c_object_files[c_source_file_index];
-                    compile_c_source_files(thread, &.{ "-c", source_file, "-o", object_path, "-std=c99"});
-                },
-                else => |t| @panic(@tagName(t)),
+// Walks the prerequisites of a make-style depfile as written by clang's -MD, skipping the target. The returned path is only
+// valid until the next call
+const DepfileIterator = struct{
+    bytes: []const u8,
+    index: usize = 0,
+    target_skipped: bool = false,
+    buffer: [std.fs.max_path_bytes]u8 = undefined,
+
+    fn is_line_continuation(iterator: *const DepfileIterator) bool {
+        return iterator.bytes[iterator.index] == '\\' and iterator.index + 1 < iterator.bytes.len and (iterator.bytes[iterator.index + 1] == '\n' or iterator.bytes[iterator.index + 1] == '\r');
+    }
+
+    fn next(iterator: *DepfileIterator) ?[]const u8 {
+        while (true) {
+            while (iterator.index < iterator.bytes.len) {
+                switch (iterator.bytes[iterator.index]) {
+                    ' ', '\t', '\n', '\r' => iterator.index += 1,
+                    else => if (iterator.is_line_continuation()) {
+                        iterator.index += 2;
+                    } else break,
+                }
             }
 
-            thread.task_system.job.complete_job();
-            assert(thread.task_system.job.worker.completed == c + 1);
+            if (iterator.index == iterator.bytes.len) return null;
+
+            var length: usize = 0;
+            while (iterator.index < iterator.bytes.len and length < iterator.buffer.len) {
+                const byte = iterator.bytes[iterator.index];
+                switch (byte) {
+                    ' ', '\t', '\n', '\r' => break,
+                    else => {},
+                }
+
+                if (iterator.is_line_continuation()) break;
+
+                const is_escape = iterator.index + 1 < iterator.bytes.len and ((byte == '\\' and (iterator.bytes[iterator.index + 1] == ' ' or iterator.bytes[iterator.index + 1] == '#')) or (byte == '$' and iterator.bytes[iterator.index + 1] == '$'));
+                if (is_escape) {
+                    iterator.index += 1;
+                }
+
+                iterator.buffer[length] = iterator.bytes[iterator.index];
+                length += 1;
+                iterator.index += 1;
+            }
+
+            const word = iterator.buffer[0..length];
+            if (!iterator.target_skipped) {
+                iterator.target_skipped = word.len > 0 and word[word.len - 1] == ':';
+                continue;
+            }
+
+            return word;
         }
+    }
+};
 
-        if (configuration.sleep_on_thread_hot_loops) {
-            std.time.sleep(1000);
-        } else {
-            std.atomic.spinLoopHint();
+// On-disk record of the files that went into a unit and their content hashes. This is a whole-unit check: if no file changed since
+// the last successful build with the same options, the unit is skipped entirely, otherwise it is rebuilt from scratch. Nothing
+// analyzed survives a build, so there is no per-file reuse to drive and the graph keeps no import edges
+const DependencyGraph = struct{
+    const magic: u32 = 0x7064_616e;
+    const version: u32 = 2;
+
+    const Header = extern struct{
+        magic: u32,
+        version: u32,
+        options_hash: u64,
+        file_count: u32,
+        path_byte_count: u64,
+    };
+
+    const FileEntry = extern struct{
+        content_hash: u64,
+        size: u64,
+        modification_time: i64,
+        path_offset: u32,
+        path_length: u32,
+    };
+
+    var build_start_time: i64 = 0;
+
+    fn get_path(unit: *Unit) []const u8 {
+        const executable_path_hash = std.hash.Wyhash.hash(0, unit.descriptor.executable_path);
+        return std.fmt.allocPrint(std.heap.page_allocator, "{s}/{x:0>16}.dep", .{dependency_graph_directory, executable_path_hash}) catch unreachable;
+    }
+
+    fn get_options_hash(unit: *Unit) u64 {
+        const descriptor = &unit.descriptor;
+        var hasher = std.hash.Wyhash.init(0);
+        for ([_][]const u8{ descriptor.main_source_file_path, descriptor.executable_path }) |string| {
+            hasher.update(std.mem.asBytes(&string.len));
+            hasher.update(string);
+        }
+        for (descriptor.c_source_files) |c_source_file| {
+            hasher.update(std.mem.asBytes(&c_source_file.len));
+            hasher.update(c_source_file);
+        }
+        if (descriptor.c_prefix_header) |c_prefix_header| {
+            hasher.update(std.mem.asBytes(&c_prefix_header.len));
+            hasher.update(c_prefix_header);
+        }
+        for (descriptor.link_inputs) |link_input| {
+            hasher.update(std.mem.asBytes(&link_input.len));
+            hasher.update(link_input);
         }
+        hasher.update(std.mem.asBytes(&descriptor.target));
+        hasher.update(std.mem.asBytes(&descriptor.optimization));
+        hasher.update(std.mem.asBytes(&descriptor.generate_debug_information));
+        hasher.update(std.mem.asBytes(&descriptor.link_libc));
+        hasher.update(std.mem.asBytes(&descriptor.link_libcpp));
+        hasher.update(std.mem.asBytes(&descriptor.codegen_backend.llvm.lto));
+
+        // A new compiler binary invalidates everything
+        const compiler_stat = std.fs.cwd().statFile(instance.paths.executable) catch unreachable;
+        const compiler_modification_time: i64 = @truncate(compiler_stat.mtime);
+        hasher.update(std.mem.asBytes(&compiler_modification_time));
+
+        return hasher.final();
     }
+
+    fn is_up_to_date(unit: *Unit) bool {
+        const graph_path = get_path(unit);
+        const bytes = std.fs.cwd().readFileAlloc(std.heap.page_allocator, graph_path, std.math.maxInt(u32)) catch return false;
+        defer std.heap.page_allocator.free(bytes);
+
+        if (bytes.len < @sizeOf(Header)) return false;
+        const header = std.mem.bytesToValue(Header, bytes[0..@sizeOf(Header)]);
+        if (header.magic != magic or header.version != version or header.options_hash != get_options_hash(unit)) return false;
+
+        const files_offset = @sizeOf(Header);
+        const paths_offset = files_offset + @as(usize, header.file_count) * @sizeOf(FileEntry);
+        if (bytes.len != paths_offset + header.path_byte_count) return false;
+
+        std.fs.cwd().access(unit.descriptor.executable_path, .{}) catch return false;
+
+        const file_entries = std.mem.bytesAsSlice(FileEntry, bytes[files_offset..paths_offset]);
+        const paths = bytes[paths_offset..];
+
+        // A damaged graph means a rebuild, never a crash
+        for (file_entries) |file_entry| {
+            if (@as(u64, file_entry.path_offset) + file_entry.path_length > paths.len) return false;
+        }
+
+        for (file_entries) |file_entry| {
+            const path = paths[file_entry.path_offset..][0..file_entry.path_length];
+            if (is_file_changed(path, file_entry)) return false;
+        }
+
+        return true;
+    }
+
+    fn is_file_changed(path: []const u8, file_entry: FileEntry) bool {
+        const file = std.fs.cwd().openFile(path, .{}) catch return true;
+        defer file.close();
+        const stat = file.stat() catch return true;
+        const modification_time: i64 = @truncate(stat.mtime);
+
+        if (stat.size == file_entry.size and modification_time == file_entry.modification_time) {
+            return false;
+        }
+
+        const content = file.readToEndAlloc(std.heap.page_allocator, std.math.maxInt(u32)) catch return true;
+        defer std.heap.page_allocator.free(content);
+        return std.hash.Wyhash.hash(0, content) != file_entry.content_hash;
+    }
+
+    fn write(unit: *Unit) void {
+        var file_entries = PinnedArray(FileEntry){};
+        var paths = PinnedArray(u8){};
+
+        for (instance.files.slice()) |*file| {
+            append_file(&file_entries, &paths, file.path, file.source_code);
+        }
+
+        for (unit.descriptor.c_source_files) |c_source_file| {
+            const content = std.fs.cwd().readFileAlloc(std.heap.page_allocator, c_source_file, std.math.maxInt(u32)) catch return;
+            defer std.heap.page_allocator.free(content);
+            append_file(&file_entries, &paths, c_source_file, content);
+        }
+
+        if (unit.descriptor.c_prefix_header) |c_prefix_header| {
+            const content = std.fs.cwd().readFileAlloc(std.heap.page_allocator, c_prefix_header, std.math.maxInt(u32)) catch return;
+            defer std.heap.page_allocator.free(content);
+            append_file(&file_entries, &paths, c_prefix_header, content);
+        }
+
+        for (unit.descriptor.link_inputs) |link_input| {
+            const content = std.fs.cwd().readFileAlloc(std.heap.page_allocator, link_input, std.math.maxInt(u32)) catch return;
+            defer std.heap.page_allocator.free(content);
+            append_file(&file_entries, &paths, link_input, content);
+
+            for (get_thin_archive_members(link_input, content)) |member_path| {
+                const member_content = std.fs.cwd().readFileAlloc(std.heap.page_allocator, member_path, std.math.maxInt(u32)) catch return;
+                defer std.heap.page_allocator.free(member_content);
+                append_file(&file_entries, &paths, member_path, member_content);
+            }
+        }
+
+        // Headers included by the C sources, so that changing one of them doesn't skip the unit
+        for (unit.descriptor.c_object_files) |c_object_file| {
+            CObjectCache.append_file_entries(c_object_file, &file_entries, &paths);
+        }
+
+        const header = Header{
+            .magic = magic,
+            .version = version,
+            .options_hash = get_options_hash(unit),
+            .file_count = file_entries.length,
+            .path_byte_count = paths.length,
+        };
+
+        std.fs.cwd().makePath(dependency_graph_directory) catch unreachable;
+        const graph_path = get_path(unit);
+        const temporary_path = std.fmt.allocPrint(std.heap.page_allocator, "{s}.tmp", .{graph_path}) catch unreachable;
+        {
+            const graph_file = std.fs.cwd().createFile(temporary_path, .{}) catch unreachable;
+            defer graph_file.close();
+            graph_file.writeAll(std.mem.asBytes(&header)) catch unreachable;
+            graph_file.writeAll(std.mem.sliceAsBytes(file_entries.const_slice())) catch unreachable;
+            graph_file.writeAll(paths.const_slice()) catch unreachable;
+        }
+        std.fs.cwd().rename(temporary_path, graph_path) catch unreachable;
+    }
+
+    fn append_file(file_entries: *PinnedArray(FileEntry), paths: *PinnedArray(u8), path: []const u8, content: []const u8) void {
+        const stat = std.fs.cwd().statFile(path) catch unreachable;
+        const modification_time: i64 = @truncate(stat.mtime);
+        _ = file_entries.append(.{
+            .content_hash = std.hash.Wyhash.hash(0, content),
+            .size = stat.size,
+            // If the file was touched while compiling, the content we hashed may be older than the timestamp. Force a rehash next time
+            .modification_time = if (modification_time < build_start_time) modification_time else 0,
+            .path_offset = paths.length,
+            .path_length = @intCast(path.len),
+        });
+        paths.append_slice(path);
+    }
+};
+
+// Objects are content-addressed: the key covers everything that determines the machine code LLVM emits for the module
+fn llvm_get_optimization_level(optimization: Optimization) LLVM.OptimizationLevel {
+    return switch (optimization) {
+        .none => unreachable,
+        .debug_prefer_fast, .debug_prefer_size => .{ .speed_level = 0, .size_level = 0 },
+        .lightly_optimize_for_speed => .{ .speed_level = 1, .size_level = 0 },
+        .optimize_for_speed => .{ .speed_level = 2, .size_level = 0 },
+        .optimize_for_size => .{ .speed_level = 2, .size_level = 1 },
+        .aggressively_optimize_for_speed => .{ .speed_level = 3, .size_level = 0 },
+        .aggressively_optimize_for_size => .{ .speed_level = 2, .size_level = 2 },
+    };
+}
+
+fn llvm_create_target_machine(target: *LLVM.Target, target_triple: []const u8, cpu: []const u8, features: []const u8, codegen_optimization_level: LLVM.CodegenOptimizationLevel) *LLVM.Target.Machine {
+    const jit = false;
+    const code_model: LLVM.CodeModel = undefined;
+    const is_code_model_present = false;
+    return target.createTargetMachine(target_triple.ptr, target_triple.len, cpu.ptr, cpu.len, features.ptr, features.len, LLVM.RelocationModel.static, code_model, is_code_model_present, codegen_optimization_level, jit);
+}
+
+// Emits the module through the object cache and returns the objects to link. `owner` is the thread whose target settings apply.
+// With more than one codegen partition, LLVM splits the module and emits every piece to its own object in parallel
+fn llvm_split_into_partitions(thread: *Thread, partition_count: u32, optimized: bool) void {
+    const partition_modules = thread.arena.new_array(*LLVM.Module, partition_count) catch unreachable;
+    thread.llvm.module.split(partition_count, partition_modules.ptr);
+    thread.llvm.partitions = thread.arena.new_array(LLVMPartition, partition_count) catch unreachable;
+    for (thread.llvm.partitions, partition_modules) |*partition, partition_module| {
+        partition.* = .{
+            .module = partition_module,
+            .optimized = optimized,
+        };
+    }
+
+    @atomicStore(u32, &thread.llvm.pending_partitions, partition_count, .release);
+
+    for (0..partition_count) |partition_index| {
+        thread.add_owned_work(.{
+            .id = .llvm_emit_partition,
+            .offset = @intCast(partition_index),
+            .count = @intCast(thread.get_index()),
+        });
+    }
+
+    thread.add_control_work(.{
+        .id = .llvm_notify_partitioned,
+    });
+}
+
+fn llvm_emit_object_cached(thread: *Thread, owner: *Thread, unit: *Unit, module: *LLVM.Module, target_machine: *LLVM.Target.Machine, temporary_object: []const u8) LLVMObjects {
+    const object_emission = unit.descriptor.codegen_backend.llvm.object_emission;
+    const cache_key = llvm_get_object_cache_key(owner, module);
+    const cached_objects = thread.arena.new_array([]const u8, 1) catch unreachable;
+    const cached_object = std.fmt.allocPrint(std.heap.page_allocator, "{s}/{s}.o", .{object_cache_directory, &cache_key}) catch unreachable;
+    cached_objects[0] = cached_object;
+    const cached_file: ?std.fs.File = std.fs.cwd().openFile(cached_object, .{ .mode = .write_only }) catch null;
+    thread.object_cache_lookups += 1;
+
+    if (cached_file) |file| {
+        // Marks the object as recently used for trim_object_cache
+        const now = std.time.nanoTimestamp();
+        file.updateTimes(now, now) catch {};
+        file.close();
+        thread.object_cache_hits += 1;
+    } else if (object_emission != .disk) {
+        // Missed objects are queued to be written to the cache while linking, off the path from emission to link
+        const buffers = thread.arena.new_array([]const u8, 1) catch unreachable;
+        var buffer_pointer: [*]const u8 = undefined;
+        var buffer_length: usize = undefined;
+        const disable_verify = builtin.mode != .Debug;
+        const result = module.emitToBuffer(target_machine, LLVM.CodeGenFileType.object, disable_verify, &buffer_pointer, &buffer_length);
+        if (!result) {
+            @panic("can't generate machine code");
+        }
+
+        buffers[0] = buffer_pointer[0..buffer_length];
+        if (object_emission == .memory_and_disk) {
+            std.fs.cwd().writeFile(.{ .sub_path = temporary_object, .data = buffers[0] }) catch unreachable;
+        }
+
+        unit.object_cache_write_back_mutex.lock();
+        defer unit.object_cache_write_back_mutex.unlock();
+
+        _ = unit.object_cache_write_back.append(.{
+            .cached_object = cached_object,
+            .temporary_object = std.fmt.allocPrint(std.heap.page_allocator, "{s}.cache", .{temporary_object}) catch unreachable,
+            .buffer = buffers[0],
+        });
+
+        return .{
+            .buffers = buffers,
+        };
+    } else {
+        std.fs.cwd().makePath(object_cache_directory) catch unreachable;
+
+        // Emit under a private name and rename, so a concurrent compilation never links a partially written object
+        const disable_verify = builtin.mode != .Debug;
+        const result = module.addPassesToEmitFile(target_machine, temporary_object.ptr, temporary_object.len, LLVM.CodeGenFileType.object, disable_verify);
+        if (!result) {
+            @panic("can't generate machine code");
+        }
+
+        std.fs.cwd().rename(temporary_object, cached_object) catch unreachable;
+    }
+
+    return .{
+        .paths = cached_objects,
+    };
+}
+
+fn llvm_get_object_cache_key(thread: *Thread, module: *LLVM.Module) [32]u8 {
+    var bitcode_hash: [32]u8 = undefined;
+    module.getBitcodeHash(&bitcode_hash);
+
+    var hasher = std.crypto.hash.Blake3.init(.{});
+    hasher.update(&bitcode_hash);
+    for ([_][]const u8{ thread.llvm.target_triple, thread.llvm.cpu, thread.llvm.features }) |string| {
+        hasher.update(std.mem.asBytes(&string.len));
+        hasher.update(string);
+    }
+    const codegen_optimization_level: u8 = @intCast(@intFromEnum(thread.llvm.codegen_optimization_level));
+    hasher.update(&.{codegen_optimization_level});
+
+    // Objects emitted by an older compiler (and the LLVM linked into it) must not be reused
+    const compiler_stat = std.fs.cwd().statFile(instance.paths.executable) catch unreachable;
+    hasher.update(std.mem.asBytes(&compiler_stat.size));
+    hasher.update(std.mem.asBytes(&compiler_stat.mtime));
+
+    var key: [16]u8 = undefined;
+    hasher.final(&key);
+    return std.fmt.bytesToHex(key, .lower);
 }
 
 const CSourceFileCompilationInvoker = enum{
@@ -6159,7 +8332,36 @@ const CSourceFileCompilationInvoker = enum{
     external,
 };
 
-fn compile_c_source_files(thread: *Thread, arguments: []const []const u8) void {
+// Flags every unit C source file is compiled with. A precompiled header can only be used with the flags it was built with,
+// so the prefix header is compiled with exactly these as well
+const c_source_file_flags = [_][]const u8{"-std=c99"};
+
+fn get_c_source_file_arguments(buffer: *std.BoundedArray([]const u8, 16), source_file: []const u8, object_path: []const u8, precompiled_header: ?[]const u8) []const []const u8 {
+    buffer.appendSliceAssumeCapacity(&.{ "-c", source_file, "-o", object_path, "-MD", "-MF", CObjectCache.get_depfile_path(object_path) });
+    buffer.appendSliceAssumeCapacity(&c_source_file_flags);
+    if (precompiled_header) |pch| {
+        buffer.appendSliceAssumeCapacity(&.{ "-include-pch", pch });
+    }
+
+    return buffer.slice();
+}
+
+fn get_c_precompiled_header(thread: *Thread, unit: *Unit) ?[]const u8 {
+    const c_prefix_header = unit.descriptor.c_prefix_header orelse return null;
+
+    unit.c_precompiled_header_mutex.lock();
+    defer unit.c_precompiled_header_mutex.unlock();
+
+    if (!unit.c_precompiled_header_ready) {
+        unit.c_precompiled_header = PrecompiledHeaderCache.get(thread, c_prefix_header);
+        unit.c_precompiled_header_ready = true;
+    }
+
+    return unit.c_precompiled_header;
+}
+
+// When `batch` is not null the clang command lines are collected into it instead of being run
+fn compile_c_source_files(thread: *Thread, arguments: []const []const u8, batch: ?*ClangBatch) void {
     var argument_index: usize = 0;
     _ = &argument_index;
     const Mode = enum {
@@ -6171,6 +8373,7 @@ fn compile_c_source_files(thread: *Thread, arguments: []const []const u8) void {
     const Extension = enum {
         c,
         cpp,
+        c_header,
         assembly,
         object,
         static_library,
@@ -6204,7 +8407,7 @@ fn compile_c_source_files(thread: *Thread, arguments: []const []const u8) void {
             if (last_byte(argument, '.')) |dot_index| {
                 const extension_string = argument[dot_index..];
                 const extension: Extension =
-                    if (byte_equal(extension_string, ".c")) .c else if (byte_equal(extension_string, ".cpp") or byte_equal(extension_string, ".cxx") or byte_equal(extension_string, ".cc")) .cpp else if (byte_equal(extension_string, ".S")) .assembly else if (byte_equal(extension_string, ".o")) .object else if (byte_equal(extension_string, ".a")) .static_library else if (byte_equal(extension_string, ".so") or
+                    if (byte_equal(extension_string, ".c")) .c else if (byte_equal(extension_string, ".h")) .c_header else if (byte_equal(extension_string, ".cpp") or byte_equal(extension_string, ".cxx") or byte_equal(extension_string, ".cc")) .cpp else if (byte_equal(extension_string, ".S")) .assembly else if (byte_equal(extension_string, ".o")) .object else if (byte_equal(extension_string, ".a")) .static_library else if (byte_equal(extension_string, ".so") or
                     byte_equal(extension_string, ".dll") or
                     byte_equal(extension_string, ".dylib") or
                     byte_equal(extension_string, ".tbd")) .shared_library else {
@@ -6213,7 +8416,7 @@ fn compile_c_source_files(thread: *Thread, arguments: []const []const u8) void {
                     @panic("Unable to recognize extension for the file above");
                 };
                 switch (extension) {
-                    .c, .cpp, .assembly => {
+                    .c, .cpp, .c_header, .assembly => {
                         c_source_files.appendAssumeCapacity(.{
                             .path = argument,
                             .extension = extension,
@@ -6270,6 +8473,11 @@ fn compile_c_source_files(thread: *Thread, arguments: []const []const u8) void {
             argument_index += 1;
             const arg = arguments[argument_index];
             cc_argv.appendAssumeCapacity(arg);
+        } else if (byte_equal(argument, "-include-pch")) {
+            cc_argv.appendAssumeCapacity(argument);
+            argument_index += 1;
+            const arg = arguments[argument_index];
+            cc_argv.appendAssumeCapacity(arg);
         } else if (byte_equal(argument, "-isystem")) {
             cc_argv.appendAssumeCapacity(argument);
             argument_index += 1;
@@ -6464,7 +8672,7 @@ fn compile_c_source_files(thread: *Thread, arguments: []const []const u8) void {
             link_objects.appendAssumeCapacity(object_path);
 
             switch (c_source_file.extension) {
-                .c, .cpp => {
+                .c, .cpp, .c_header => {
                     argv.appendAssumeCapacity("-nostdinc");
                     argv.appendAssumeCapacity("-fno-spell-checking");
 
@@ -6612,7 +8820,11 @@ fn compile_c_source_files(thread: *Thread, arguments: []const []const u8) void {
                 std.debug.print("Argv: {s}\n", .{argv.slice()});
             }
 
-            clang_main(thread.arena, argv.slice());
+            if (batch) |b| {
+                b.append(thread.arena, argv.slice());
+            } else {
+                clang_main(thread.arena, argv.slice());
+            }
         }
     } else if (link_objects.len == 0) {
         unreachable;
@@ -6652,6 +8864,60 @@ fn clang_main(arena: *Arena, arguments: []const []const u8) void {
     }
 }
 
+// The command lines are collected by the job that sets the batch up; the cc1 invocations then run as one job per file.
+// The last of those jobs runs the files the driver has to handle itself and writes the object cache
+const ClangBatch = struct{
+    argvs: PinnedArray([*:null]?[*:0]u8) = .{},
+    argcs: PinnedArray(c_int) = .{},
+    compiled_objects: PinnedArray(CObjectCache.Compiled) = .{},
+    handle: ?*NatClangBatch = null,
+    pending_count: u32 = 0,
+    failure_count: u32 = 0,
+
+    fn append(batch: *ClangBatch, arena: *Arena, arguments: []const []const u8) void {
+        const argv = library.argument_copy_zero_terminated(arena, arguments) catch unreachable;
+        _ = batch.argvs.append(argv.ptr);
+        _ = batch.argcs.append(@intCast(arguments.len));
+    }
+
+    fn compile(batch: *ClangBatch, file_index: u32, thread_index: u16) void {
+        if (!nat_clang_batch_compile(batch.handle.?, file_index, thread_index)) {
+            _ = @atomicRmw(u32, &batch.failure_count, .Add, 1, .monotonic);
+        }
+    }
+
+    // The last job keeps its count until the batch is finished, so the control thread can't see the batch done before the objects are
+    fn complete_pending(batch: *ClangBatch) void {
+        var pending_count = @atomicLoad(u32, &batch.pending_count, .acquire);
+        while (pending_count != 1) {
+            pending_count = @cmpxchgWeak(u32, &batch.pending_count, pending_count, pending_count - 1, .acq_rel, .acquire) orelse return;
+        }
+
+        if (batch.handle) |handle| {
+            const fallback_failure_count = nat_clang_batch_finish(handle);
+            batch.handle = null;
+
+            if (batch.failure_count + @as(u32, @intCast(fallback_failure_count)) != 0) {
+                @breakpoint();
+                std.posix.exit(1);
+            }
+
+            for (batch.compiled_objects.const_slice()) |compiled_object| {
+                CObjectCache.write(compiled_object.object_path, compiled_object.flags_hash);
+            }
+        }
+
+        // Only now can the control thread see the batch as done
+        @atomicStore(u32, &batch.pending_count, 0, .release);
+    }
+};
+
+const NatClangBatch = opaque{};
+extern "c" fn nat_clang_batch_create(argvs: [*]const [*:null]?[*:0]u8, argcs: [*]const c_int, count: usize, worker_count: c_uint) *NatClangBatch;
+extern "c" fn nat_clang_batch_is_serial(batch: *const NatClangBatch) bool;
+extern "c" fn nat_clang_batch_compile(batch: *NatClangBatch, index: usize, worker_index: c_uint) bool;
+extern "c" fn nat_clang_batch_finish(batch: *NatClangBatch) c_int;
+
 fn llvm_emit_parameter_attributes(thread: *Thread, abi: Function.Abi.Information, is_return: bool) *const LLVM.Attribute.Set{
     var attributes = std.BoundedArray(*LLVM.Attribute, 64){};
     if (abi.attributes.zero_extend) {
@@ -6761,20 +9027,9 @@ fn llvm_get_intrinsic_function(thread: *Thread, parameters: LLVMIntrinsic.Parame
 }
 
 fn llvm_get_value(thread: *Thread, value: *Value) *LLVM.Value {
-    if (value.llvm) |llvm| {
+    if (value.get_llvm(thread)) |llvm| {
         assert(value.sema.thread == thread.get_index());
-        if (llvm.getContext() != thread.llvm.context) {
-            std.debug.print("Value was assigned to thread #{} ", .{thread.get_index()});
-            const thread_index = for (instance.threads, 0..) |*t, i| {
-                if (t.functions.length > 0) {
-                    if (t.llvm.context == llvm.getContext()) {
-                        break i;
-                    }
-                }
-            } else unreachable;
-            std.debug.print("but context from which it was generated belongs to thread #{}\n", .{thread_index});
-            @panic("internal error");
-        }
+        assert(llvm.getContext() == thread.llvm.context);
         return llvm;
     } else {
         const value_id = value.sema.id;
@@ -6838,14 +9093,14 @@ fn llvm_get_value(thread: *Thread, value: *Value) *LLVM.Value {
             else => |t| @panic(@tagName(t)),
         };
 
-        value.llvm = llvm_value;
+        value.set_llvm(thread, llvm_value);
 
         return llvm_value;
     }
 }
 
 fn llvm_get_debug_type(thread: *Thread, builder: *LLVM.DebugInfo.Builder, ty: *Type) *LLVM.DebugInfo.Type {
-    if (ty.llvm_debug) |llvm| return llvm else {
+    if (ty.get_llvm_debug(thread)) |llvm| return llvm else {
         const llvm_debug_type = switch (ty.sema.id) {
             .integer => block: {
                 const integer = ty.get_payload(.integer);
@@ -6946,7 +9201,7 @@ fn llvm_get_debug_type(thread: *Thread, builder: *LLVM.DebugInfo.Builder, ty: *T
                     .all_calls_described = false,
                 };
                 const file = file_struct.file;
-                const name = thread.identifiers.get(nat_struct_type.declaration.name).?;
+                const name = instance.identifiers.get_string(nat_struct_type.declaration.name);
                 const line = nat_struct_type.declaration.line;
 
                 const bitsize = nat_struct_type.type.size * 8;
@@ -6954,11 +9209,11 @@ fn llvm_get_debug_type(thread: *Thread, builder: *LLVM.DebugInfo.Builder, ty: *T
                 var member_types = PinnedArray(*LLVM.DebugInfo.Type){};
 
                 const struct_type = builder.createStructType(file.toScope(), name.ptr, name.len, file, line, bitsize, alignment, flags, null, member_types.pointer, member_types.length, null);
-                ty.llvm_debug = struct_type.toType();
+                ty.set_llvm_debug(thread, struct_type.toType());
 
                 for (nat_struct_type.fields) |field| {
                     const field_type = llvm_get_debug_type(thread, builder, field.type);
-                    const field_name = thread.identifiers.get(field.name).?;
+                    const field_name = instance.identifiers.get_string(field.name);
                     const field_bitsize = field.type.size * 8;
                     const field_alignment = field.type.alignment * 8;
                     const field_offset = field.member_offset * 8;
@@ -7002,7 +9257,7 @@ fn llvm_get_debug_type(thread: *Thread, builder: *LLVM.DebugInfo.Builder, ty: *T
                     .all_calls_described = false,
                 };
                 const file = file_struct.file;
-                const name = thread.identifiers.get(nat_bitfield_type.declaration.name).?;
+                const name = instance.identifiers.get_string(nat_bitfield_type.declaration.name);
                 const line = nat_bitfield_type.declaration.line;
 
                 const bitsize = nat_bitfield_type.type.size * 8;
@@ -7010,13 +9265,13 @@ fn llvm_get_debug_type(thread: *Thread, builder: *LLVM.DebugInfo.Builder, ty: *T
                 var member_types = PinnedArray(*LLVM.DebugInfo.Type){};
 
                 const struct_type = builder.createStructType(file.toScope(), name.ptr, name.len, file, line, bitsize, alignment, flags, null, member_types.pointer, member_types.length, null);
-                ty.llvm_debug = struct_type.toType();
+                ty.set_llvm_debug(thread, struct_type.toType());
 
                 const nat_backing_type = &thread.integers[nat_bitfield_type.type.bit_size - 1];
                 const backing_type = llvm_get_debug_type(thread, builder, &nat_backing_type.type);
 
                 for (nat_bitfield_type.fields) |field| {
-                    const field_name = thread.identifiers.get(field.name).?;
+                    const field_name = instance.identifiers.get_string(field.name);
                     const field_bitsize = field.type.bit_size;
                     const field_offset = field.member_offset;
                     const member_flags = LLVM.DebugInfo.Node.Flags{
@@ -7109,14 +9364,14 @@ fn llvm_get_debug_type(thread: *Thread, builder: *LLVM.DebugInfo.Builder, ty: *T
             else => |t| @panic(@tagName(t)),
         };
 
-        ty.llvm_debug = llvm_debug_type;
+        ty.set_llvm_debug(thread, llvm_debug_type);
 
         return llvm_debug_type;
     }
 }
 
 fn llvm_get_type(thread: *Thread, ty: *Type) *LLVM.Type {
-    if (ty.llvm) |llvm| {
+    if (ty.get_llvm(thread)) |llvm| {
         assert(ty.sema.thread == thread.get_index());
         assert(llvm.getContext() == thread.llvm.context);
         return llvm;
@@ -7161,7 +9416,7 @@ fn llvm_get_type(thread: *Thread, ty: *Type) *LLVM.Type {
 
                 const types = struct_types.const_slice();
                 const is_packed = false;
-                const name = thread.identifiers.get(nat_struct_type.declaration.name).?;
+                const name = instance.identifiers.get_string(nat_struct_type.declaration.name);
                 const struct_type = thread.llvm.context.createStructType(types.ptr, types.len, name.ptr, name.len, is_packed);
                 break :b struct_type.toType();
             },
@@ -7186,7 +9441,7 @@ fn llvm_get_type(thread: *Thread, ty: *Type) *LLVM.Type {
             else => |t| @panic(@tagName(t)),
         };
 
-        ty.llvm = llvm_type;
+        ty.set_llvm(thread, llvm_type);
 
         return llvm_type;
     }
@@ -7226,7 +9481,7 @@ fn llvm_get_file(thread: *Thread, file_index: u32) *LLVMFile {
 fn llvm_get_scope(thread: *Thread, scope: *Scope) *LLVM.DebugInfo.Scope {
     assert(scope.id != .file);
 
-    if (scope.llvm) |llvm| {
+    if (scope.get_llvm(thread)) |llvm| {
         return llvm;
     } else {
         const llvm_scope = switch (scope.id) {
@@ -7239,7 +9494,7 @@ fn llvm_get_scope(thread: *Thread, scope: *Scope) *LLVM.DebugInfo.Scope {
             },
             else => |t| @panic(@tagName(t)),
         };
-        scope.llvm = llvm_scope;
+        scope.set_llvm(thread, llvm_scope);
         return llvm_scope;
     }
 }
@@ -7250,8 +9505,8 @@ const calling_convention_map = std.EnumArray(CallingConvention, LLVM.Value.Const
 });
 
 fn llvm_emit_function_declaration(thread: *Thread, nat_function: *Function.Declaration) void {
-    assert(nat_function.global_symbol.value.llvm == null);
-    const function_name = thread.identifiers.get(nat_function.global_symbol.global_declaration.declaration.name) orelse unreachable;
+    assert(nat_function.global_symbol.value.get_llvm(thread) == null);
+    const function_name = instance.identifiers.get_string(nat_function.global_symbol.global_declaration.declaration.name);
     const nat_function_type = nat_function.get_function_type();
     const function_type = llvm_get_type(thread, &nat_function_type.type);
     const is_extern_function = nat_function.global_symbol.attributes.@"extern";
@@ -7329,15 +9584,15 @@ fn llvm_emit_function_declaration(thread: *Thread, nat_function: *Function.Decla
         const scope_line = line + 1;
 
         const subprogram = llvm_file.builder.createFunction(scope, function_name.ptr, function_name.len, function_name.ptr, function_name.len, file, line, subroutine_type, scope_line, subroutine_type_flags, subprogram_flags, subprogram_declaration);
-        nat_function.global_symbol.type.llvm_debug = subroutine_type.toType();
+        nat_function.global_symbol.type.set_llvm_debug(thread, subroutine_type.toType());
         function.setSubprogram(subprogram);
         if (nat_function.global_symbol.id == .function_definition) {
             const function_definition = nat_function.global_symbol.get_payload(.function_definition);
-            function_definition.scope.scope.llvm = subprogram.toLocalScope().toScope();
+            function_definition.scope.scope.set_llvm(thread, subprogram.toLocalScope().toScope());
         }
     }
 
-    nat_function.global_symbol.value.llvm = function.toValue();
+    nat_function.global_symbol.value.set_llvm(thread, function.toValue());
 }
 
 fn create_constant_int(thread: *Thread, args: struct {
@@ -8468,7 +10723,7 @@ pub fn analyze_file(thread: *Thread, file_index: u32) void {
                     fail_message("discard identifier '_' cannot be used as a global variable name");
                 }
 
-                top_level_declaration_name = thread.identifiers.get(global_name).?;
+                top_level_declaration_name = instance.identifiers.get_string(global_name);
 
                 if (file.scope.scope.get_global_declaration(global_name)) |existing_global| {
                     _ = existing_global; // autofix
@@ -8544,7 +10799,7 @@ pub fn analyze_file(thread: *Thread, file_index: u32) void {
                             parser.skip_space(src);
 
                             const bitfield_name = parser.parse_identifier(thread, src);
-                            top_level_declaration_name = thread.identifiers.get(bitfield_name).?;
+                            top_level_declaration_name = instance.identifiers.get_string(bitfield_name);
 
                             const bitfield_type = thread.bitfields.append(.{
                                 .type = .{
@@ -8713,7 +10968,7 @@ pub fn analyze_file(thread: *Thread, file_index: u32) void {
 
                     const function_name = parser.parse_identifier(thread, src);
                     function_declaration_data.global_symbol.global_declaration.declaration.name = function_name;
-                    top_level_declaration_name = thread.identifiers.get(function_name).?;
+                    top_level_declaration_name = instance.identifiers.get_string(function_name);
 
                     parser.skip_space(src);
 
@@ -9317,6 +11572,7 @@ pub fn analyze_file(thread: *Thread, file_index: u32) void {
                                 .current_function = function,
                                 .current_basic_block = entry_block,
                                 .current_scope = &function.scope.scope,
+                                .arena = thread.arena,
                             };
                             analyzer.current_scope = &analyzer.current_function.scope.scope;
 
@@ -9605,11 +11861,11 @@ pub fn analyze_file(thread: *Thread, file_index: u32) void {
                     }
 
                     const filename_without_extension = filename[0..filename.len - ".nat".len];
-                    const filename_without_extension_hash = hash_bytes(filename_without_extension);
+                    const filename_without_extension_hash = intern_identifier(thread, filename_without_extension);
                     const directory_path = file.get_directory_path();
                     const directory = std.fs.openDirAbsolute(directory_path, .{}) catch unreachable;
                     const file_path = library.realpath(thread.arena, directory, string_literal) catch unreachable;
-                    const file_path_hash = intern_identifier(&thread.identifiers, file_path);
+                    const file_path_hash = intern_identifier(thread, file_path);
                     // std.debug.print("Interning '{s}' (0x{x}) in thread #{}\n", .{file_path, file_path_hash, thread.get_index()});
                     
                     for (thread.imports.slice()) |import| {
@@ -9632,12 +11888,14 @@ pub fn analyze_file(thread: *Thread, file_index: u32) void {
                             .hash = file_path_hash,
                         });
                         _ = import.files.append(file);
-                        _ = file.imports.append(import);
+                        _ = file.imports.append(thread.arena, import);
                         const global_declaration_reference: **GlobalDeclaration = @ptrCast(file.scope.scope.declarations.put_no_clobber(filename_without_extension_hash, &import.global_declaration.declaration));
-                        const import_values = file.values_per_import.append(.{});
+                        const import_values = file.values_per_import.append(thread.arena, .{});
                         const lazy_expression = thread.lazy_expressions.append(LazyExpression.init(global_declaration_reference, thread));
-                        _ = import_values.append(&lazy_expression.value);
+                        _ = import_values.append(thread.arena, &lazy_expression.value);
 
+                        // Counted before the request leaves, while this thread still has an unfinished file of its own
+                        AnalysisState.add_unfinished_file();
                         thread.add_control_work(.{
                             .id = .analyze_file,
                             .offset = file_path_hash,
@@ -9654,7 +11912,7 @@ pub fn analyze_file(thread: *Thread, file_index: u32) void {
                     parser.skip_space(src);
 
                     const struct_name = parser.parse_identifier(thread, src);
-                    top_level_declaration_name = thread.identifiers.get(struct_name).?;
+                    top_level_declaration_name = instance.identifiers.get_string(struct_name);
 
                     parser.skip_space(src);
 
@@ -9830,6 +12088,9 @@ pub fn analyze_file(thread: *Thread, file_index: u32) void {
         }
     } 
 
+    // Parsing is done: from now on the source is only touched for diagnostics and debug information
+    library.advise_file(.{ .bytes = src, .is_mapped = file.source_is_mapped }, .normal);
+
     for (file.local_lazy_expressions.slice()) |local_lazy_expression| {
         const name = local_lazy_expression.name;
         if (file.scope.scope.get_global_declaration(name)) |global_declaration| {
@@ -9862,7 +12123,7 @@ pub fn analyze_file(thread: *Thread, file_index: u32) void {
                 else => |t| @panic(@tagName(t)),
             }
         } else {
-            fail_term("Unable to find lazy expression", thread.identifiers.get(name).?);
+            fail_term("Unable to find lazy expression", instance.identifiers.get_string(name));
         }
     }
 
@@ -9892,21 +12153,7 @@ fn try_resolve_file(thread: *Thread, file: *File) void {
         }
         file.state = .analyzed;
         thread.analyzed_file_count += 1;
-
-        // If the thread has analyzed the same files it has been assigned, tell the control thread
-        // that the thread has finished file analysis so it can proceed to the next step
-        if (thread.analyzed_file_count == thread.assigned_file_count) {
-            if (@atomicLoad(@TypeOf(thread.task_system.job.queuer.to_do), &thread.task_system.job.queuer.to_do, .seq_cst) == thread.task_system.job.worker.completed + 1) {
-                if (configuration.timers) {
-                    thread.time.timers.getPtr(.analysis).end = get_instant();
-                }
-                thread.add_control_work(.{
-                    .id = .notify_analysis_complete,
-                });
-            } else {
-                unreachable;
-            }
-        }
+        AnalysisState.finish_file();
 
         for (file.interested_threads.slice()) |ti| {
             thread.add_control_work(.{
@@ -10079,7 +12326,7 @@ fn emit_argument_symbol(analyzer: *Analyzer, thread: *Thread, args: struct{
             .column = args.column,
         }),
     });
-    _ = analyzer.current_function.arguments.append(argument_symbol);
+    _ = analyzer.current_function.arguments.append(thread.arena, argument_symbol);
 
     return argument_symbol;
 }
@@ -10129,7 +12376,7 @@ fn emit_local_symbol(analyzer: *Analyzer, thread: *Thread, args: struct{
         .alignment = if (args.alignment) |a| a else args.type.alignment,
     });
 
-    _ = analyzer.current_function.stack_slots.append(local_symbol);
+    _ = analyzer.current_function.stack_slots.append(thread.arena, local_symbol);
 
     if (args.name != 0) {
         _ = analyzer.current_scope.declarations.put_no_clobber(args.name, &local_symbol.local_declaration.declaration);
@@ -10287,9 +12534,7 @@ fn new_instruction(thread: *Thread, args: struct {
                 .resolved = args.resolved,
             },
         },
-        .scope = args.scope,
-        .line = args.line,
-        .column = args.column,
+        .debug_location = thread.get_debug_location(args.scope, args.line, args.column),
     };
 }
 
@@ -10317,7 +12562,7 @@ fn emit_jump(analyzer: *Analyzer, thread: *Thread, args: struct {
     const original_block = analyzer.current_basic_block;
     analyzer.append_instruction(&jump.instruction);
     analyzer.current_basic_block.is_terminated = true;
-    _ = args.basic_block.predecessors.append(analyzer.current_basic_block);
+    _ = args.basic_block.predecessors.append(thread.arena, analyzer.current_basic_block);
 
     return .{
         .jump = jump,
@@ -10354,8 +12599,8 @@ fn emit_branch(analyzer: *Analyzer, thread: *Thread, args: struct {
     const original_block = analyzer.current_basic_block;
     analyzer.append_instruction(&branch.instruction);
     analyzer.current_basic_block.is_terminated = true;
-    _ = args.taken.predecessors.append(analyzer.current_basic_block);
-    _ = args.not_taken.predecessors.append(analyzer.current_basic_block);
+    _ = args.taken.predecessors.append(thread.arena, analyzer.current_basic_block);
+    _ = args.not_taken.predecessors.append(thread.arena, analyzer.current_basic_block);
 
     return .{
         .branch = branch,
@@ -10589,6 +12834,12 @@ pub const LLVM = struct {
         const setTargetTriple = bindings.NativityLLVMModuleSetTargetTriple;
         const runOptimizationPipeline = bindings.NativityLLVMRunOptimizationPipeline;
         const addPassesToEmitFile = bindings.NativityLLVMModuleAddPassesToEmitFile;
+        const emitToBuffer = bindings.NativityLLVMModuleEmitToBuffer;
+        const writeThinLTOBitcode = bindings.NativityLLVMModuleWriteThinLTOBitcode;
+        const getBitcodeHash = bindings.NativityLLVMModuleGetBitcodeHash;
+        const split = bindings.NativityLLVMModuleSplit;
+        const getDefinedFunctionCount = bindings.NativityLLVMModuleGetDefinedFunctionCount;
+        const disposePartition = bindings.NativityLLVMModuleDisposePartition;
         const link = bindings.NativityLLVMLinkModules;
     };
 
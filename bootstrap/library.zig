@@ -15,6 +15,7 @@ pub const Arena = struct {
     commit_position: u64,
     alignment: u64,
     size: u64,
+    policy: CommitPolicy,
 
     pub const Temporary = struct {
         arena: *Arena,
@@ -24,15 +25,20 @@ pub const Arena = struct {
     pub const commit_granularity = 2 * 1024 * 1024;
 
     pub fn init(requested_size: u64) !*Arena {
+        return init_with_policy(requested_size, .{
+            .granularity = commit_granularity,
+        });
+    }
+
+    pub fn init_with_policy(requested_size: u64, policy: CommitPolicy) !*Arena {
+        assert(policy.granularity % commit_granularity == 0);
         var size = requested_size;
-        const size_roundup_granularity = commit_granularity;
+        const size_roundup_granularity = policy.granularity;
         size += size_roundup_granularity - 1;
         size -= size % size_roundup_granularity;
-        const initial_commit_size = commit_granularity;
-        assert(initial_commit_size >= @sizeOf(Arena));
 
-        const reserved_memory = try reserve(size);
-        try commit(reserved_memory, initial_commit_size);
+        const reserved_memory = try reserve_with_policy(size, policy);
+        const initial_commit_size = try commit_with_policy(reserved_memory, 0, @sizeOf(Arena), size, policy);
 
         const arena: *Arena = @alignCast(@ptrCast(reserved_memory));
         arena.* = .{
@@ -40,6 +46,7 @@ pub const Arena = struct {
             .commit_position = initial_commit_size,
             .alignment = 8,
             .size = size,
+            .policy = policy,
         };
 
         return arena;
@@ -55,13 +62,7 @@ pub const Arena = struct {
             arena.position += size + alignment;
 
             if (arena.commit_position < arena.position) {
-                var size_to_commit = arena.position - arena.commit_position;
-                size_to_commit += commit_granularity - 1;
-                size_to_commit -= size_to_commit % commit_granularity;
-
-                try commit(base + arena.commit_position, size_to_commit);
-
-                arena.commit_position += size_to_commit;
+                arena.commit_position = try commit_with_policy(base, arena.commit_position, arena.position, arena.size, arena.policy);
             }
 
             return result;
@@ -155,19 +156,120 @@ pub fn DynamicBoundedArray(comptime T: type) type {
     };
 }
 
+/// Growable list for short per-node lists (the instructions of a basic block, its predecessors, function arguments...).
+/// The first `inline_capacity` items are stored in the struct itself; past that the items move to an arena block that doubles
+/// when it fills up. Outgrown blocks are left in the arena, which at most doubles the footprint of a list.
+/// Unlike PinnedArray there is no address space reservation per list, so a million basic blocks don't turn into two million mappings.
+/// The slice is only valid until the next append.
+pub fn SmallVector(comptime T: type, comptime inline_capacity: comptime_int) type {
+    return struct {
+        inline_items: [inline_capacity]T = undefined,
+        heap_items: [*]T = undefined,
+        length: u32 = 0,
+        capacity: u32 = inline_capacity,
+
+        const Vector = @This();
+        const minimum_heap_capacity = @max(2 * inline_capacity, 4);
+
+        fn items(vector: *Vector) [*]T {
+            return if (vector.capacity > inline_capacity) vector.heap_items else &vector.inline_items;
+        }
+
+        fn const_items(vector: *const Vector) [*]const T {
+            return if (vector.capacity > inline_capacity) vector.heap_items else &vector.inline_items;
+        }
+
+        pub fn slice(vector: *Vector) []T {
+            return vector.items()[0..vector.length];
+        }
+
+        pub fn const_slice(vector: *const Vector) []const T {
+            return vector.const_items()[0..vector.length];
+        }
+
+        pub fn get(vector: *Vector, index: u32) *T {
+            assert(index < vector.length);
+            return &vector.items()[index];
+        }
+
+        pub fn append(vector: *Vector, arena: *Arena, item: T) *T {
+            vector.ensure_capacity(arena, 1);
+            const pointer = &vector.items()[vector.length];
+            pointer.* = item;
+            vector.length += 1;
+            return pointer;
+        }
+
+        pub fn append_slice(vector: *Vector, arena: *Arena, new_items: []const T) void {
+            const count: u32 = @intCast(new_items.len);
+            vector.ensure_capacity(arena, count);
+            @memcpy(vector.items()[vector.length..][0..count], new_items);
+            vector.length += count;
+        }
+
+        fn ensure_capacity(vector: *Vector, arena: *Arena, additional: u32) void {
+            const length = vector.length + additional;
+            if (length > vector.capacity) {
+                var new_capacity: u32 = @max(vector.capacity, minimum_heap_capacity);
+                while (new_capacity < length) {
+                    new_capacity *= 2;
+                }
+
+                arena.align_forward(@alignOf(T));
+                const new_items = arena.new_array(T, new_capacity) catch unreachable;
+                @memcpy(new_items[0..vector.length], vector.slice());
+                vector.heap_items = new_items.ptr;
+                vector.capacity = new_capacity;
+            }
+        }
+
+        pub fn clear(vector: *Vector) void {
+            vector.length = 0;
+        }
+    };
+}
+
 const pinned_array_page_size = 2 * 1024 * 1024;
 const pinned_array_max_size = std.math.maxInt(u32) - pinned_array_page_size;
 const pinned_array_default_granularity = pinned_array_page_size;
 
 const small_granularity = std.mem.page_size;
 const large_granularity = 2 * 1024 * 1024;
+
+/// How a pinned structure commits the address space it reserved. Big, hot structures want a few large commits backed by
+/// huge pages and populated up front; the many small ones want to commit as little as possible.
+pub const CommitPolicy = struct {
+    granularity: u64,
+    // Commit at least as much again as is already committed, so the number of commit syscalls is logarithmic in the final size
+    geometric: bool = false,
+    // Ask for transparent huge pages (Linux). The reservation is aligned to the huge page size so whole commits can be backed by them
+    huge_pages: bool = false,
+    // Populate committed ranges right away instead of taking a page fault on the first write to every page (Linux 5.14+)
+    prefault: bool = false,
+};
+
+pub const small_commit_policy = CommitPolicy{
+    .granularity = small_granularity,
+};
+
+pub const large_commit_policy = CommitPolicy{
+    .granularity = large_granularity,
+    .geometric = true,
+    .huge_pages = true,
+    .prefault = true,
+};
+
 // This must be used with big arrays, which are not resizeable (can't be cleared)
 pub fn PinnedArray(comptime T: type) type {
-    return PinnedArrayAdvanced(T, null, small_granularity);
+    return PinnedArrayAdvanced(T, null, small_commit_policy);
+}
+
+pub fn PinnedArrayWithPolicy(comptime T: type, comptime policy: CommitPolicy) type {
+    return PinnedArrayAdvanced(T, null, policy);
 }
 
 // This must be used with big arrays, which are not resizeable (can't be cleared)
-pub fn PinnedArrayAdvanced(comptime T: type, comptime MaybeIndex: ?type, comptime granularity: comptime_int) type {
+pub fn PinnedArrayAdvanced(comptime T: type, comptime MaybeIndex: ?type, comptime policy: CommitPolicy) type {
     return struct {
         pointer: [*]T = undefined,
         length: u32 = 0,
@@ -213,22 +315,16 @@ pub fn PinnedArrayAdvanced(comptime T: type, comptime MaybeIndex: ?type, comptim
         pub fn ensure_capacity(array: *Array, additional: u32) void {
             if (array.committed == 0) {
                 assert(array.length == 0);
-                array.pointer = @alignCast(@ptrCast(reserve(pinned_array_max_size) catch unreachable));
+                array.pointer = @alignCast(@ptrCast(reserve_with_policy(pinned_array_max_size, policy) catch unreachable));
             }
 
-            const length = array.length;
-            const size = length * @sizeOf(T);
-            const granularity_aligned_size = align_forward(size, granularity);
-            const new_size = size + additional * @sizeOf(T);
-
-            if (granularity_aligned_size < new_size) {
-                assert((length + additional) * @sizeOf(T) <= pinned_array_max_size);
-                const new_granularity_aligned_size = align_forward(new_size, granularity);
-                const pointer: [*]u8 = @ptrCast(array.pointer);
-                const commit_pointer = pointer + granularity_aligned_size;
-                const commit_size = new_granularity_aligned_size - granularity_aligned_size;
-                commit(commit_pointer, commit_size) catch unreachable;
-                array.committed += @intCast(@divExact(commit_size, granularity));
+            const committed_size = @as(u64, array.committed) * policy.granularity;
+            const new_size = (@as(u64, array.length) + additional) * @sizeOf(T);
+
+            if (committed_size < new_size) {
+                assert(new_size <= pinned_array_max_size);
+                const new_committed_size = commit_with_policy(@ptrCast(array.pointer), committed_size, new_size, pinned_array_max_size, policy) catch unreachable;
+                array.committed = @intCast(@divExact(new_committed_size, policy.granularity));
             }
         }
 
@@ -305,7 +401,7 @@ pub fn PinnedArrayAdvanced(comptime T: type, comptime MaybeIndex: ?type, comptim
         pub fn in_range(array: *@This(), item: *T) bool {
             if (array.committed == 0) return false;
             if (@intFromPtr(item) < @intFromPtr(array.pointer)) return false;
-            const top = @intFromPtr(array.pointer) + array.committed * granularity;
+            const top = @intFromPtr(array.pointer) + array.committed * policy.granularity;
             if (@intFromPtr(item) >= top) return false;
             return true;
         }
@@ -328,6 +424,8 @@ pub fn reserve(size: u64) ![*]u8 {
 }
 
 pub fn commit(bytes: [*]u8, size: u64) !void {
+    _ = memory_statistics.commit_syscalls.fetchAdd(1, .monotonic);
+    _ = memory_statistics.committed_bytes.fetchAdd(size, .monotonic);
     const slice = bytes[0..size];
     return switch (os) {
         .linux, .macos => try std.posix.mprotect(@alignCast(slice), std.posix.PROT.WRITE | std.posix.PROT.READ),
@@ -336,6 +434,75 @@ pub fn commit(bytes: [*]u8, size: u64) !void {
     };
 }
 
+const huge_page_size = 2 * 1024 * 1024;
+const madvise_hugepage = 14;
+const madvise_populate_write = 23;
+
+pub const MemoryStatistics = struct {
+    commit_syscalls: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+    committed_bytes: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+    advise_syscalls: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+};
+
+pub var memory_statistics = MemoryStatistics{};
+
+pub const PageFaults = struct {
+    minor: u64 = 0,
+    major: u64 = 0,
+};
+
+pub fn get_page_faults() PageFaults {
+    return switch (os) {
+        .windows => .{},
+        else => b: {
+            const usage = std.posix.getrusage(std.posix.rusage.SELF);
+            break :b .{
+                .minor = @intCast(usage.minflt),
+                .major = @intCast(usage.majflt),
+            };
+        },
+    };
+}
+
+fn advise_memory(bytes: [*]u8, size: u64, advice: u32) void {
+    if (os == .linux) {
+        _ = memory_statistics.advise_syscalls.fetchAdd(1, .monotonic);
+        // Failure only means the kernel doesn't know the advice (or THP is disabled); the memory works the same either way
+        _ = std.os.linux.madvise(bytes, size, advice);
+    }
+}
+
+pub fn reserve_with_policy(size: u64, policy: CommitPolicy) ![*]u8 {
+    if (policy.huge_pages and os == .linux) {
+        const unaligned = try reserve(size + huge_page_size);
+        const result: [*]u8 = @ptrFromInt(align_forward(@intFromPtr(unaligned), huge_page_size));
+        advise_memory(result, size, madvise_hugepage);
+        return result;
+    } else {
+        return try reserve(size);
+    }
+}
+
+/// Commits enough of a reserved range to hold `required` bytes, following the policy, and returns the new committed size
+pub fn commit_with_policy(base: [*]u8, committed: u64, required: u64, reserved: u64, policy: CommitPolicy) !u64 {
+    if (required <= committed) return committed;
+
+    var new_committed = align_forward(required, policy.granularity);
+    if (policy.geometric) {
+        const geometric_size = @min(align_forward(committed * 2, policy.granularity), reserved - reserved % policy.granularity);
+        new_committed = @max(new_committed, geometric_size);
+    }
+
+    const commit_size = new_committed - committed;
+    try commit(base + committed, commit_size);
+
+    if (policy.prefault) {
+        advise_memory(base + committed, commit_size, madvise_populate_write);
+    }
+
+    return new_committed;
+}
+
 pub fn getIndexForType(comptime T: type, comptime E: type) type {
     assert(@typeInfo(E) == .Enum);
     _ = T;
@@ -372,6 +539,132 @@ fn JointEnum(comptime enums: []const type, comptime backing_type: ?type) type {
     });
 }
 
+pub fn is_space(ch: u8, next_ch: u8) bool {
+    const is_comment = ch == '/' and next_ch == '/';
+    const is_whitespace = ch == ' ';
+    const is_vertical_tab = ch == 0x0b;
+    const is_horizontal_tab = ch == '\t';
+    const is_line_feed = ch == '\n';
+    const is_carry_return = ch == '\r';
+    const result = ((is_vertical_tab or is_horizontal_tab) or (is_line_feed or is_carry_return)) or (is_comment or is_whitespace);
+    return result;
+}
+
+fn safe_flag(value: anytype, boolean: bool) @TypeOf(value) {
+    const result = value & (@as(@TypeOf(value), 0) -% @intFromBool(boolean));
+    return result;
+}
+
+pub fn get_next_ch_safe(file: []const u8, index: u64) u8 {
+    const next_index = index + 1;
+    const is_in_range = next_index < file.len;
+    const safe_index = safe_flag(next_index, is_in_range);
+    const unsafe_result = file[safe_index];
+    const safe_result = safe_flag(unsafe_result, is_in_range);
+    return safe_result;
+}
+
+/// Byte-at-a-time reference implementation. `parser` must have `i`, `line` and `column` fields
+pub fn skip_space_scalar(parser: anytype, file: []const u8) void {
+    const original_i = parser.i;
+
+    if (original_i == file.len or !is_space(file[original_i], get_next_ch_safe(file, original_i))) return;
+
+    while (parser.i < file.len) : (parser.i += 1) {
+        const ch = file[parser.i];
+        const new_line = ch == '\n';
+        parser.line += @intFromBool(new_line);
+
+        if (new_line) {
+            parser.column = @intCast(parser.i + 1);
+        }
+
+        if (!is_space(ch, get_next_ch_safe(file, parser.i))) {
+            return;
+        }
+
+        if (file[parser.i] == '/') {
+            parser.i += 2;
+
+            while (parser.i < file.len) : (parser.i += 1) {
+                const is_line_feed = file[parser.i] == '\n';
+                if (is_line_feed) {
+                    parser.line += 1;
+                    break;
+                }
+            }
+
+            if (parser.i == file.len) break;
+        }
+    }
+}
+
+const space_block_size = @min(std.simd.suggestVectorLength(u8) orelse 16, 32);
+const SpaceBlock = @Vector(space_block_size, u8);
+const SpaceMask = std.meta.Int(.unsigned, space_block_size);
+
+fn space_block_mask(block: SpaceBlock, ch: u8) SpaceMask {
+    return @bitCast(block == @as(SpaceBlock, @splat(ch)));
+}
+
+/// Same results as `skip_space_scalar`, but whitespace runs and comment bodies are scanned a whole vector at a time.
+/// Line feeds are popcounted per block. The last few bytes of the file go through the scalar path
+pub fn skip_space(parser: anytype, file: []const u8) void {
+    const original_i = parser.i;
+
+    if (original_i == file.len or !is_space(file[original_i], get_next_ch_safe(file, original_i))) return;
+
+    while (parser.i + space_block_size <= file.len) {
+        const block: SpaceBlock = file[parser.i..][0..space_block_size].*;
+        const line_feeds = space_block_mask(block, '\n');
+        const spaces = space_block_mask(block, ' ') | space_block_mask(block, '\t') | space_block_mask(block, 0x0b) | space_block_mask(block, '\r') | line_feeds;
+        const space_count = @ctz(~spaces);
+
+        const skipped_line_feeds = if (space_count == space_block_size) line_feeds else line_feeds & ((@as(SpaceMask, 1) << @intCast(space_count)) - 1);
+        if (skipped_line_feeds != 0) {
+            parser.line += @popCount(skipped_line_feeds);
+            const last_line_feed = space_block_size - 1 - @clz(skipped_line_feeds);
+            parser.column = @intCast(parser.i + last_line_feed + 1);
+        }
+
+        parser.i += space_count;
+
+        if (space_count != space_block_size) {
+            if (file[parser.i] == '/' and get_next_ch_safe(file, parser.i) == '/') {
+                parser.i += 2;
+                skip_to_line_feed(parser, file);
+
+                if (parser.i == file.len) return;
+
+                // Like the scalar path, the line feed ending a comment bumps the line but not the column
+                parser.line += 1;
+                parser.i += 1;
+            } else {
+                return;
+            }
+        }
+    }
+
+    skip_space_scalar(parser, file);
+}
+
+fn skip_to_line_feed(parser: anytype, file: []const u8) void {
+    while (parser.i + space_block_size <= file.len) {
+        const block: SpaceBlock = file[parser.i..][0..space_block_size].*;
+        const line_feeds = space_block_mask(block, '\n');
+        if (line_feeds != 0) {
+            parser.i += @ctz(line_feeds);
+            return;
+        }
+
+        parser.i += space_block_size;
+    }
+
+    while (parser.i < file.len and file[parser.i] != '\n') {
+        parser.i += 1;
+    }
+}
+
 pub const fnv_offset = 14695981039346656037;
 pub const fnv_prime = 1099511628211;
 pub fn my_hash(bytes: []const u8) u32 {
@@ -437,35 +730,144 @@ pub fn byte_equal_terminated(a: [*:0]const u8, b: [*:0]const u8) bool {
 const pinned_hash_map_page_size = 2 * 1024 * 1024;
 const pinned_hash_map_max_size = std.math.maxInt(u32) - pinned_hash_map_page_size;
 const pinned_hash_map_default_granularity = pinned_hash_map_page_size;
+// The index is reserved as one region: slot indices first, then the control bytes
+const pinned_hash_map_max_index_capacity = 1 << 28;
+const pinned_hash_map_index_size = pinned_hash_map_max_index_capacity * (@sizeOf(u32) + 1);
+const pinned_hash_map_initial_index_capacity = 2 * hash_map_group_size;
+
+const hash_map_group_size = 16;
+const HashMapGroup = @Vector(hash_map_group_size, u8);
+const hash_map_control_empty: u8 = 0x80;
 
 pub fn PinnedHashMap(comptime K: type, comptime V: type) type {
-    return PinnedHashMapAdvanced(K, V, small_granularity);
+    return PinnedHashMapAdvanced(K, V, small_commit_policy, AutoHashContext(K));
+}
+
+pub fn AutoHashContext(comptime K: type) type {
+    return struct {
+        pub fn hash(key: K) u64 {
+            return switch (@typeInfo(K)) {
+                .Pointer => |pointer| switch (pointer.size) {
+                    .Slice => hash_mix(hash_bytes64(std.mem.sliceAsBytes(key))),
+                    else => hash_mix(@intFromPtr(key)),
+                },
+                else => hash_mix(hash_key(fnv_offset, key)),
+            };
+        }
+
+        pub fn eql(a: K, b: K) bool {
+            return switch (@typeInfo(K)) {
+                .Pointer => |pointer| switch (pointer.size) {
+                    .Slice => byte_equal(std.mem.sliceAsBytes(a), std.mem.sliceAsBytes(b)),
+                    else => a == b,
+                },
+                .Struct, .Array => equal(a, b),
+                else => a == b,
+            };
+        }
+    };
+}
+
+pub fn hash_bytes64(bytes: []const u8) u64 {
+    var result: u64 = fnv_offset;
+
+    for (bytes) |byte| {
+        result ^= byte;
+        result *%= fnv_prime;
+    }
+
+    return result;
+}
+
+// Final avalanche step (splitmix64), so the low bits used to pick a group and the top bits used as a tag are both well distributed
+pub fn hash_mix(value: u64) u64 {
+    var result = value;
+    result ^= result >> 30;
+    result *%= 0xbf58476d1ce4e5b9;
+    result ^= result >> 27;
+    result *%= 0x94d049bb133111eb;
+    result ^= result >> 31;
+    return result;
+}
+
+fn hash_word(seed: u64, word: u64) u64 {
+    return (seed ^ word) *% fnv_prime;
+}
+
+// Mirrors the semantics of `equal`: nested slices are compared by pointer and length, not by content
+pub fn hash_key(seed: u64, key: anytype) u64 {
+    const T = @TypeOf(key);
+
+    switch (@typeInfo(T)) {
+        .Struct => |info| {
+            var result = seed;
+            inline for (info.fields) |field_info| {
+                result = hash_key(result, @field(key, field_info.name));
+            }
+            return result;
+        },
+        .Union => |info| {
+            if (info.tag_type) |UnionTag| {
+                const tag = activeTag(key);
+                const result = hash_word(seed, @intFromEnum(tag));
+
+                inline for (info.fields) |field_info| {
+                    if (@field(UnionTag, field_info.name) == tag) {
+                        return hash_key(result, @field(key, field_info.name));
+                    }
+                }
+                unreachable;
+            }
+
+            @compileError("cannot hash untagged union type " ++ @typeName(T));
+        },
+        .Array => {
+            var result = seed;
+            for (key) |element| {
+                result = hash_key(result, element);
+            }
+            return result;
+        },
+        .Pointer => |info| {
+            return switch (info.size) {
+                .One, .Many, .C => hash_word(seed, @intFromPtr(key)),
+                .Slice => hash_word(hash_word(seed, @intFromPtr(key.ptr)), key.len),
+            };
+        },
+        .Optional => {
+            return if (key) |k| hash_key(hash_word(seed, 1), k) else hash_word(seed, 0);
+        },
+        .Enum => return hash_word(seed, @intFromEnum(key)),
+        .Bool => return hash_word(seed, @intFromBool(key)),
+        .Int => |info| {
+            if (info.bits > 64) @compileError("cannot hash integer type " ++ @typeName(T));
+            const Unsigned = std.meta.Int(.unsigned, info.bits);
+            return hash_word(seed, @as(Unsigned, @bitCast(key)));
+        },
+        else => @compileError("cannot hash type " ++ @typeName(T)),
+    }
 }
 
-pub fn PinnedHashMapAdvanced(comptime K: type, comptime V: type, comptime granularity: comptime_int) type {
+/// Open-addressing hash map. Keys and values live in pinned arrays in insertion order, so value pointers are never invalidated;
+/// the index maps a hash to the position in those arrays. The index is split into groups of 16 control bytes, each holding
+/// the top 7 bits of the hash of the entry it belongs to (or the empty marker), so a whole group is matched at once with a vector compare.
+/// The context type must provide `hash(K) u64` and `eql(K, K) bool`.
+pub fn PinnedHashMapAdvanced(comptime K: type, comptime V: type, comptime policy: CommitPolicy, comptime Context: type) type {
     return struct {
         key_pointer: [*]K = undefined,
         value_pointer: [*]V = undefined,
+        slot_pointer: [*]u32 = undefined,
+        control_pointer: [*]u8 = undefined,
         length: u64 = 0,
+        capacity: u32 = 0,
         committed_key: u32 = 0,
         committed_value: u32 = 0,
 
         const Map = @This();
 
         pub fn get_pointer(map: *Map, key: K) ?*V {
-            for (map.keys(), 0..) |k, i| {
-                const is_equal = switch (@typeInfo(K)) {
-                    .Pointer => |pointer| switch (pointer.size) {
-                        .Slice => byte_equal(k, key),
-                        else => k == key,
-                    },
-                    .Struct, .Array => equal(k, key),
-                    else => k == key,
-                };
-
-                if (is_equal) {
-                    return &map.value_pointer[i];
-                }
+            if (map.find(key, Context.hash(key))) |index| {
+                return &map.value_pointer[index];
             }
 
             return null;
@@ -480,21 +882,27 @@ pub fn PinnedHashMapAdvanced(comptime K: type, comptime V: type, comptime granul
         }
 
         pub fn put(map: *@This(), key: K, value: V) *V {
-            if (map.get_pointer(key)) |value_pointer| {
+            const hash = Context.hash(key);
+            if (map.find(key, hash)) |index| {
+                const value_pointer = &map.value_pointer[index];
                 value_pointer.* = value;
                 return value_pointer;
             } else {
-                const len = map.length;
-                map.ensure_capacity(len + 1);
-                return map.put_at_with_capacity(len, key, value);
+                return map.put_new(key, hash, value);
             }
         }
 
         pub fn put_no_clobber(map: *@This(), key: K, value: V) *V {
-            assert(map.get_pointer(key) == null);
-            const len = map.length;
-            map.ensure_capacity(len + 1);
-            return map.put_at_with_capacity(len, key, value);
+            const hash = Context.hash(key);
+            assert(map.find(key, hash) == null);
+            return map.put_new(key, hash, value);
+        }
+
+        fn put_new(map: *@This(), key: K, hash: u64, value: V) *V {
+            map.ensure_capacity(1);
+            const index = map.length;
+            map.insert_slot(@intCast(index), hash);
+            return map.put_at_with_capacity(index, key, value);
         }
 
         fn put_at_with_capacity(map: *@This(), index: u64, key: K, value: V) *V {
@@ -505,44 +913,118 @@ pub fn PinnedHashMapAdvanced(comptime K: type, comptime V: type, comptime granul
             return &map.value_pointer[index];
         }
 
+        fn control_tag(hash: u64) u8 {
+            return @intCast(hash >> 57);
+        }
+
+        fn find(map: *Map, key: K, hash: u64) ?u32 {
+            if (map.capacity == 0) return null;
+
+            const tag: HashMapGroup = @splat(control_tag(hash));
+            const empty: HashMapGroup = @splat(hash_map_control_empty);
+            const group_mask = map.capacity / hash_map_group_size - 1;
+            var group_index: u32 = @as(u32, @truncate(hash)) & group_mask;
+            var stride: u32 = 0;
+
+            while (true) {
+                const group_offset = group_index * hash_map_group_size;
+                const control: HashMapGroup = map.control_pointer[group_offset..][0..hash_map_group_size].*;
+
+                var matches: u16 = @bitCast(control == tag);
+                while (matches != 0) : (matches &= matches - 1) {
+                    const index = map.slot_pointer[group_offset + @ctz(matches)];
+                    if (Context.eql(map.key_pointer[index], key)) {
+                        return index;
+                    }
+                }
+
+                const empties: u16 = @bitCast(control == empty);
+                if (empties != 0) return null;
+
+                // Triangular probing visits every group when the group count is a power of two
+                stride += 1;
+                group_index = (group_index + stride) & group_mask;
+            }
+        }
+
+        fn insert_slot(map: *Map, index: u32, hash: u64) void {
+            const empty: HashMapGroup = @splat(hash_map_control_empty);
+            const group_mask = map.capacity / hash_map_group_size - 1;
+            var group_index: u32 = @as(u32, @truncate(hash)) & group_mask;
+            var stride: u32 = 0;
+
+            while (true) {
+                const group_offset = group_index * hash_map_group_size;
+                const control: HashMapGroup = map.control_pointer[group_offset..][0..hash_map_group_size].*;
+                const empties: u16 = @bitCast(control == empty);
+
+                if (empties != 0) {
+                    const slot = group_offset + @ctz(empties);
+                    map.control_pointer[slot] = control_tag(hash);
+                    map.slot_pointer[slot] = index;
+                    return;
+                }
+
+                stride += 1;
+                group_index = (group_index + stride) & group_mask;
+            }
+        }
+
         fn ensure_capacity(map: *Map, additional: u64) void {
             if (map.committed_key == 0) {
-                map.key_pointer = @alignCast(@ptrCast(reserve(pinned_hash_map_max_size) catch unreachable));
-                map.value_pointer = @alignCast(@ptrCast(reserve(pinned_hash_map_max_size) catch unreachable));
+                map.key_pointer = @alignCast(@ptrCast(reserve_with_policy(pinned_hash_map_max_size, policy) catch unreachable));
+                map.value_pointer = @alignCast(@ptrCast(reserve_with_policy(pinned_hash_map_max_size, policy) catch unreachable));
+                const index_pointer = reserve_with_policy(pinned_hash_map_index_size, policy) catch unreachable;
+                map.slot_pointer = @alignCast(@ptrCast(index_pointer));
+                map.control_pointer = index_pointer + pinned_hash_map_max_index_capacity * @sizeOf(u32);
             }
 
             const length = map.length;
-            assert((length + additional) * @sizeOf(K) <= pinned_array_max_size);
-
-            {
-                const key_size = length * @sizeOf(K);
-                const key_granularity_aligned_size = align_forward(key_size, granularity);
-                const key_new_size = key_size + additional * @sizeOf(K);
-
-                if (key_granularity_aligned_size < key_new_size) {
-                    const new_key_granularity_aligned_size = align_forward(key_new_size, granularity);
-                    const key_pointer: [*]u8 = @ptrCast(map.key_pointer);
-                    const commit_pointer = key_pointer + key_granularity_aligned_size;
-                    const commit_size = new_key_granularity_aligned_size - key_granularity_aligned_size;
-                    commit(commit_pointer, commit_size) catch unreachable;
-                    map.committed_key += @intCast(@divExact(commit_size, granularity));
-                }
+            assert((length + additional) * @sizeOf(K) <= pinned_hash_map_max_size);
+            assert((length + additional) * @sizeOf(V) <= pinned_hash_map_max_size);
+
+            map.committed_key = commit_units(@ptrCast(map.key_pointer), map.committed_key, (length + additional) * @sizeOf(K));
+            map.committed_value = commit_units(@ptrCast(map.value_pointer), map.committed_value, (length + additional) * @sizeOf(V));
+
+            // Keep the load factor under 7/8
+            var new_capacity: u64 = @max(map.capacity, pinned_hash_map_initial_index_capacity);
+            while ((length + additional) * 8 > new_capacity * 7) {
+                new_capacity *= 2;
             }
 
-            {
-                const value_size = length * @sizeOf(V);
-                const value_granularity_aligned_size = align_forward(value_size, granularity);
-                const value_new_size = value_size + additional * @sizeOf(K);
-
-                if (value_granularity_aligned_size < value_new_size) {
-                    const new_value_granularity_aligned_size = align_forward(value_new_size, granularity);
-                    const value_pointer: [*]u8 = @ptrCast(map.value_pointer);
-                    commit(value_pointer + value_granularity_aligned_size, new_value_granularity_aligned_size - value_granularity_aligned_size) catch unreachable;
-                    const commit_pointer = value_pointer + value_granularity_aligned_size;
-                    const commit_size = new_value_granularity_aligned_size - value_granularity_aligned_size;
-                    commit(commit_pointer, commit_size) catch unreachable;
-                    map.committed_value += @intCast(@divExact(commit_size, granularity));
-                }
+            if (new_capacity != map.capacity) {
+                map.grow_index(@intCast(new_capacity));
+            }
+        }
+
+        // Sizes of the key and value arrays are tracked in granularity units
+        fn commit_units(pointer: [*]u8, committed: u32, required: u64) u32 {
+            const committed_size = @as(u64, committed) * policy.granularity;
+            const new_committed_size = commit_with_policy(pointer, committed_size, required, pinned_hash_map_max_size, policy) catch unreachable;
+            return @intCast(@divExact(new_committed_size, policy.granularity));
+        }
+
+        // The index doubles on its own, so it is committed exactly
+        fn commit_index(pointer: [*]u8, old_size: u64, new_size: u64) void {
+            const committed_size = align_forward(old_size, policy.granularity);
+            _ = commit_with_policy(pointer, committed_size, new_size, pinned_hash_map_index_size, .{
+                .granularity = policy.granularity,
+                .prefault = policy.prefault,
+            }) catch unreachable;
+        }
+
+        // Entries never move, so growing only rebuilds the index from the pinned key array
+        fn grow_index(map: *Map, new_capacity: u32) void {
+            assert(new_capacity <= pinned_hash_map_max_index_capacity);
+            const old_capacity = map.capacity;
+            commit_index(@ptrCast(map.slot_pointer), @as(u64, old_capacity) * @sizeOf(u32), @as(u64, new_capacity) * @sizeOf(u32));
+            commit_index(map.control_pointer, old_capacity, new_capacity);
+
+            map.capacity = new_capacity;
+            @memset(map.control_pointer[0..new_capacity], hash_map_control_empty);
+
+            for (map.keys(), 0..) |key, index| {
+                map.insert_slot(@intCast(index), Context.hash(key));
             }
         }
 
@@ -556,10 +1038,55 @@ pub fn PinnedHashMapAdvanced(comptime K: type, comptime V: type, comptime granul
 
         pub fn clear(map: *Map) void {
             map.length = 0;
+            if (map.capacity != 0) {
+                @memset(map.control_pointer[0..map.capacity], hash_map_control_empty);
+            }
         }
     };
 }
 
+pub const StringHashContext = struct {
+    pub fn hash(key: []const u8) u64 {
+        return std.hash.Wyhash.hash(0, key);
+    }
+
+    pub fn eql(a: []const u8, b: []const u8) bool {
+        return byte_equal(a, b);
+    }
+};
+
+pub const StringMap = PinnedHashMapAdvanced([]const u8, u32, small_commit_policy, StringHashContext);
+
+/// Hands out dense ids to strings in insertion order. Lookups compare the whole string, so two different strings never share an id.
+/// One table is shared by every thread: inserts and string -> id lookups take the mutex, while id -> string is a plain read
+/// of a pinned array (an id is only ever seen by a thread after the insert that created it has been published).
+/// Callers are expected to keep a thread-local StringMap in front of `intern` so the lock is only taken on first sight of a string.
+/// Strings are not copied; they must outlive the interner.
+pub const Interner = struct {
+    ids: StringMap = .{},
+    strings: PinnedArray([]const u8) = .{},
+    mutex: std.Thread.Mutex = .{},
+
+    pub fn intern(interner: *Interner, string: []const u8) u32 {
+        interner.mutex.lock();
+        defer interner.mutex.unlock();
+
+        if (interner.ids.get(string)) |id| {
+            return id;
+        }
+
+        const id = interner.strings.length;
+        _ = interner.strings.append(string);
+        _ = interner.ids.put_no_clobber(string, id);
+        return id;
+    }
+
+    pub fn get_string(interner: *Interner, id: u32) []const u8 {
+        // Reading the length here would race with inserts on other threads; the pointer itself never changes after the first insert
+        return interner.strings.pointer[id];
+    }
+};
+
 pub const ListType = enum {
     index,
     pointer,
@@ -794,8 +1321,8 @@ pub fn exit_with_error() noreturn {
     std.posix.exit(1);
 }
 
-pub fn read_file(arena: *Arena, directory: std.fs.Dir, file_relative_path: []const u8) []const u8 {
-    const source_file = directory.openFile(file_relative_path, .{}) catch |err| {
+fn open_file(directory: std.fs.Dir, file_relative_path: []const u8) std.fs.File {
+    return directory.openFile(file_relative_path, .{}) catch |err| {
         const stdout = std.io.getStdOut();
         stdout.writeAll("Can't find file '") catch {};
         stdout.writeAll(file_relative_path) catch {};
@@ -805,6 +1332,10 @@ pub fn read_file(arena: *Arena, directory: std.fs.Dir, file_relative_path: []con
         stdout.writeAll(@errorName(err)) catch {};
         @panic("Unrecoverable error");
     };
+}
+
+pub fn read_file(arena: *Arena, directory: std.fs.Dir, file_relative_path: []const u8) []const u8 {
+    const source_file = open_file(directory, file_relative_path);
 
     const file_size = source_file.getEndPos() catch unreachable;
     var file_buffer = arena.new_array(u8, file_size) catch unreachable;
@@ -817,6 +1348,74 @@ pub fn read_file(arena: *Arena, directory: std.fs.Dir, file_relative_path: []con
     return file_buffer[0..read_byte_count];
 }
 
+pub const MappedFile = struct {
+    bytes: []const u8,
+    is_mapped: bool,
+};
+
+// Below this size the copy is cheaper than the mapping syscalls and the page-granular footprint
+const file_map_threshold = 16 * page_size;
+
+/// Maps regular files read-only instead of copying them. Small files are read into the arena and
+/// pipes or character devices (e.g. /dev/stdin), whose size is not known upfront, are read until EOF
+pub fn map_file(arena: *Arena, directory: std.fs.Dir, file_relative_path: []const u8) MappedFile {
+    const source_file = open_file(directory, file_relative_path);
+    defer source_file.close();
+
+    const stat = source_file.stat() catch unreachable;
+    switch (stat.kind) {
+        .file => {
+            switch (os) {
+                .windows => {},
+                else => if (stat.size >= file_map_threshold) {
+                    const mapping = std.posix.mmap(null, stat.size, std.posix.PROT.READ, .{ .TYPE = .PRIVATE }, source_file.handle, 0) catch unreachable;
+                    advise_file(.{ .bytes = mapping, .is_mapped = true }, .sequential);
+                    return .{
+                        .bytes = mapping,
+                        .is_mapped = true,
+                    };
+                },
+            }
+
+            const file_buffer = arena.new_array(u8, stat.size) catch unreachable;
+            const read_byte_count = source_file.readAll(file_buffer) catch unreachable;
+            assert(read_byte_count == stat.size);
+
+            return .{
+                .bytes = file_buffer[0..read_byte_count],
+                .is_mapped = false,
+            };
+        },
+        else => {
+            const bytes = source_file.readToEndAlloc(std.heap.page_allocator, std.math.maxInt(u32)) catch unreachable;
+            return .{
+                .bytes = bytes,
+                .is_mapped = false,
+            };
+        },
+    }
+}
+
+pub const FileAdvice = enum {
+    sequential,
+    normal,
+};
+
+pub fn advise_file(file: MappedFile, advice: FileAdvice) void {
+    if (!file.is_mapped) return;
+
+    switch (os) {
+        .windows => {},
+        else => {
+            const pointer: [*]align(page_size) u8 = @alignCast(@constCast(file.bytes.ptr));
+            std.posix.madvise(pointer, file.bytes.len, switch (advice) {
+                .sequential => std.posix.MADV.SEQUENTIAL,
+                .normal => std.posix.MADV.NORMAL,
+            }) catch {};
+        },
+    }
+}
+
 pub fn self_exe_path(arena: *Arena) ![]const u8 {
     var buffer: [std.fs.max_path_bytes]u8 = undefined;
     return try arena.duplicate_bytes(try std.fs.selfExePath(&buffer));
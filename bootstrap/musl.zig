@@ -0,0 +1,2044 @@
+const std = @import("std");
+
+const library = @import("library.zig");
+const Arena = library.Arena;
+const BoundedArray = library.BoundedArray;
+
+// Content addressed musl build, driven by `nat musl`. Every object is keyed by its source and compile arguments, so a partial or
+// interrupted build is repaired by compiling only what is missing and a flag change only rebuilds what it affects.
+// Headers are not part of the keys; bump `cache_version` when they change
+
+const musl_lib_dir_relative_path = "lib/libc/musl/";
+// Seed of every musl cache key
+const cache_version: u64 = 1;
+
+const include_relative_paths = [_][]const u8{
+    musl_lib_dir_relative_path ++ "arch/x86_64",
+    musl_lib_dir_relative_path ++ "arch/generic",
+    musl_lib_dir_relative_path ++ "src/include",
+    musl_lib_dir_relative_path ++ "src/internal",
+    musl_lib_dir_relative_path ++ "include",
+    "lib/libc/include/x86_64-linux-musl",
+    "lib/libc/include/generic-musl",
+};
+
+const crt_source_files = [_][]const u8{
+    musl_lib_dir_relative_path ++ "crt/crt1.c",
+    musl_lib_dir_relative_path ++ "crt/crti.c",
+    musl_lib_dir_relative_path ++ "crt/x86_64/crtn.s",
+};
+
+const MuslContext = struct {
+    compiler_path: []const u8,
+    include_paths: [include_relative_paths.len][]const u8,
+
+    // Flags shared by every musl object. They are part of the cache key of each object, so changing them rebuilds what they affect
+    fn get_compile_arguments(musl: *const MuslContext, args: *BoundedArray([]const u8, 64), source_path: []const u8, output_path: []const u8, is_crt: bool) []const []const u8 {
+        args.len = 0;
+        args.appendSliceAssumeCapacity(&.{
+            musl.compiler_path, "clang",
+            "--no-default-config", "-fno-caret-diagnostics", "-target", "x86_64-unknown-linux-musl", "-std=c99", "-ffreestanding", "-mred-zone", "-fno-omit-frame-pointer", "-fno-stack-protector", "-O2", "-fno-unwind-tables", "-fno-asynchronous-unwind-tables", "-ffunction-sections", "-fdata-sections", "-gdwarf-4", "-gdwarf32", "-Wa,--noexecstack", "-D_XOPEN_SOURCE=700",
+        });
+        if (is_crt) {
+            args.appendAssumeCapacity("-DCRT");
+        }
+        for (musl.include_paths) |include_path| {
+            args.appendSliceAssumeCapacity(&.{ "-I", include_path });
+        }
+        args.appendSliceAssumeCapacity(&.{ "-c", source_path, "-o", output_path });
+
+        return args.slice();
+    }
+};
+
+// Argument lengths are hashed too, so moving bytes from one argument to the next changes the key
+fn get_object_key(source: []const u8, arguments: []const []const u8) u64 {
+    var hasher = std.hash.Wyhash.init(cache_version);
+    hasher.update(source);
+    for (arguments) |argument| {
+        hasher.update(std.mem.asBytes(&argument.len));
+        hasher.update(argument);
+    }
+    return hasher.final();
+}
+
+fn run_compiler(allocator: std.mem.Allocator, argv: []const []const u8) bool {
+    const result = std.process.Child.run(.{
+        .allocator = allocator,
+        .argv = argv,
+        .max_output_bytes = std.math.maxInt(u32),
+    }) catch return false;
+
+    const success = switch (result.term) {
+        .Exited => |exit_code| exit_code == 0,
+        else => false,
+    };
+
+    if (!success) {
+        std.debug.print("{s}\n", .{result.stderr});
+    }
+
+    return success;
+}
+
+const MuslObject = struct {
+    source_path: []const u8,
+    cache_path: []const u8,
+    is_crt: bool,
+};
+
+const MuslBuild = struct {
+    musl: *const MuslContext,
+    misses: []const MuslObject,
+    next_miss: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+    failed: std.atomic.Value(bool) = std.atomic.Value(bool).init(false),
+
+    // Every worker keeps taking the next miss until there are none left. The in-process clang driver is not thread-safe, so each
+    // object is compiled by a `nat clang` child. Objects are compiled under a private name and renamed, so an interrupted build
+    // never leaves a truncated object behind in the cache
+    fn work(build: *MuslBuild, worker_index: usize) void {
+        var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+        defer arena.deinit();
+        const allocator = arena.allocator();
+
+        while (true) {
+            const miss_index = build.next_miss.fetchAdd(1, .monotonic);
+            if (miss_index >= build.misses.len) break;
+
+            const object = build.misses[miss_index];
+            const temporary_path = std.fmt.allocPrint(allocator, "{s}.tmp{}", .{ object.cache_path, worker_index }) catch unreachable;
+            var args_buffer = BoundedArray([]const u8, 64){};
+            const args = build.musl.get_compile_arguments(&args_buffer, object.source_path, temporary_path, object.is_crt);
+
+            if (run_compiler(allocator, args)) {
+                std.fs.cwd().rename(temporary_path, object.cache_path) catch build.failed.store(true, .monotonic);
+            } else {
+                build.failed.store(true, .monotonic);
+            }
+        }
+    }
+};
+
+// Builds libc.a and the crt objects into `cache_directory`. `root_path` is the directory holding lib/libc. Misses are compiled on
+// `thread_count` threads, and libc.a and the crt objects are replaced atomically once all their objects exist. libc.a is a thin
+// archive written by `nat ar` over the content-addressed objects, and is only rewritten when one of them changed
+pub fn build(arena: *Arena, compiler_path: []const u8, root_path: []const u8, cache_directory: []const u8, thread_count: usize) !void {
+    var musl = MuslContext{
+        .compiler_path = compiler_path,
+        .include_paths = undefined,
+    };
+    for (&musl.include_paths, include_relative_paths) |*include_path, relative_path| {
+        include_path.* = try arena.join(&.{ root_path, "/", relative_path });
+    }
+
+    const object_directory = try arena.join(&.{ cache_directory, "/o" });
+    try std.fs.cwd().makePath(object_directory);
+
+    var args_buffer = BoundedArray([]const u8, 64){};
+    var objects = BoundedArray(MuslObject, 4096){};
+    var misses = BoundedArray(MuslObject, 4096){};
+    var archive_hasher = std.hash.Wyhash.init(cache_version);
+
+    const source_groups = [_][]const []const u8{ &generic_musl_source_files, &musl_x86_64_source_files, &crt_source_files };
+    for (source_groups, 0..) |source_files, group_index| {
+        for (source_files) |source_relative_path| {
+            const source_path = try arena.join(&.{ root_path, "/", source_relative_path });
+            const is_crt = group_index == source_groups.len - 1 and !std.mem.endsWith(u8, source_relative_path, ".s");
+
+            const source = try std.fs.cwd().readFileAlloc(std.heap.page_allocator, source_path, std.math.maxInt(u32));
+            // The output path is left out since it is derived from the key itself
+            const key = get_object_key(source, musl.get_compile_arguments(&args_buffer, source_path, "", is_crt));
+            std.heap.page_allocator.free(source);
+            archive_hasher.update(std.mem.asBytes(&key));
+
+            const object = MuslObject{
+                .source_path = source_path,
+                .cache_path = try std.fmt.allocPrint(std.heap.page_allocator, "{s}/{x:0>16}.o", .{ object_directory, key }),
+                .is_crt = is_crt,
+            };
+            objects.appendAssumeCapacity(object);
+
+            std.fs.cwd().access(object.cache_path, .{}) catch misses.appendAssumeCapacity(object);
+        }
+    }
+
+    if (misses.len > 0) {
+        var musl_build = MuslBuild{
+            .musl = &musl,
+            .misses = misses.slice(),
+        };
+
+        var workers = BoundedArray(std.Thread, 512){};
+        const worker_count = @min(thread_count, misses.len, workers.capacity());
+        for (1..worker_count) |worker_index| {
+            workers.appendAssumeCapacity(try std.Thread.spawn(.{}, MuslBuild.work, .{ &musl_build, worker_index }));
+        }
+        musl_build.work(0);
+        for (workers.slice()) |worker| {
+            worker.join();
+        }
+
+        if (musl_build.failed.load(.monotonic)) {
+            return error.musl_object_failed;
+        }
+    }
+
+    const library_objects = objects.slice()[0 .. objects.len - crt_source_files.len];
+    const crt_objects = objects.slice()[objects.len - crt_source_files.len ..];
+
+    // The archive records which objects it was built from, so it is only rebuilt when one of them changed
+    const archive_path = try arena.join(&.{ cache_directory, "/libc.a" });
+    const archive_key_path = try arena.join(&.{ cache_directory, "/libc.a.key" });
+    const archive_key = archive_hasher.final();
+    const is_archive_valid = b: {
+        var key_buffer: [@sizeOf(u64)]u8 = undefined;
+        const key_bytes = std.fs.cwd().readFile(archive_key_path, &key_buffer) catch break :b false;
+        if (key_bytes.len != key_buffer.len or std.mem.bytesToValue(u64, &key_buffer) != archive_key) break :b false;
+        std.fs.cwd().access(archive_path, .{}) catch break :b false;
+        break :b true;
+    };
+
+    if (!is_archive_valid) {
+        var archive_args = BoundedArray([]const u8, 4096 + 8){};
+        archive_args.appendSliceAssumeCapacity(&.{ compiler_path, "ar", "-o", archive_path, "-thin", "true", "-members" });
+        for (library_objects) |object| {
+            archive_args.appendAssumeCapacity(object.cache_path);
+        }
+
+        // The objects live in the content-addressed cache right next to the archive, so it only needs to reference them
+        if (!run_compiler(std.heap.page_allocator, archive_args.slice())) {
+            return error.musl_archive_failed;
+        }
+
+        const temporary_key_path = try arena.join(&.{ archive_key_path, ".tmp" });
+        try std.fs.cwd().writeFile(.{
+            .sub_path = temporary_key_path,
+            .data = std.mem.asBytes(&archive_key),
+        });
+        try std.fs.cwd().rename(temporary_key_path, archive_key_path);
+    }
+
+    for (crt_objects, [_][]const u8{ "/crt1.o", "/crti.o", "/crtn.o" }) |object, name| {
+        const crt_path = try arena.join(&.{ cache_directory, name });
+        const temporary_crt_path = try arena.join(&.{ crt_path, ".tmp" });
+        try std.fs.cwd().copyFile(object.cache_path, std.fs.cwd(), temporary_crt_path, .{});
+        try std.fs.cwd().rename(temporary_crt_path, crt_path);
+    }
+}
+
+test {
+    std.testing.refAllDecls(@This());
+}
+
+test "object keys change with the source and every argument" {
+    const key = get_object_key("int a;", &.{ "-O2", "-c" });
+    try std.testing.expectEqual(key, get_object_key("int a;", &.{ "-O2", "-c" }));
+    try std.testing.expect(key != get_object_key("int b;", &.{ "-O2", "-c" }));
+    try std.testing.expect(key != get_object_key("int a;", &.{ "-O1", "-c" }));
+    try std.testing.expect(get_object_key("", &.{ "-DA", "B" }) != get_object_key("", &.{ "-D", "AB" }));
+}
+
+const generic_musl_source_files = [_][]const u8{
+    musl_lib_dir_relative_path ++ "src/aio/aio.c",
+    musl_lib_dir_relative_path ++ "src/aio/aio_suspend.c",
+    musl_lib_dir_relative_path ++ "src/aio/lio_listio.c",
+    musl_lib_dir_relative_path ++ "src/complex/__cexp.c",
+    musl_lib_dir_relative_path ++ "src/complex/__cexpf.c",
+    musl_lib_dir_relative_path ++ "src/complex/cabs.c",
+    musl_lib_dir_relative_path ++ "src/complex/cabsf.c",
+    musl_lib_dir_relative_path ++ "src/complex/cabsl.c",
+    musl_lib_dir_relative_path ++ "src/complex/cacos.c",
+    musl_lib_dir_relative_path ++ "src/complex/cacosf.c",
+    musl_lib_dir_relative_path ++ "src/complex/cacosh.c",
+    musl_lib_dir_relative_path ++ "src/complex/cacoshf.c",
+    musl_lib_dir_relative_path ++ "src/complex/cacoshl.c",
+    musl_lib_dir_relative_path ++ "src/complex/cacosl.c",
+    musl_lib_dir_relative_path ++ "src/complex/carg.c",
+    musl_lib_dir_relative_path ++ "src/complex/cargf.c",
+    musl_lib_dir_relative_path ++ "src/complex/cargl.c",
+    musl_lib_dir_relative_path ++ "src/complex/casin.c",
+    musl_lib_dir_relative_path ++ "src/complex/casinf.c",
+    musl_lib_dir_relative_path ++ "src/complex/casinh.c",
+    musl_lib_dir_relative_path ++ "src/complex/casinhf.c",
+    musl_lib_dir_relative_path ++ "src/complex/casinhl.c",
+    musl_lib_dir_relative_path ++ "src/complex/casinl.c",
+    musl_lib_dir_relative_path ++ "src/complex/catan.c",
+    musl_lib_dir_relative_path ++ "src/complex/catanf.c",
+    musl_lib_dir_relative_path ++ "src/complex/catanh.c",
+    musl_lib_dir_relative_path ++ "src/complex/catanhf.c",
+    musl_lib_dir_relative_path ++ "src/complex/catanhl.c",
+    musl_lib_dir_relative_path ++ "src/complex/catanl.c",
+    musl_lib_dir_relative_path ++ "src/complex/ccos.c",
+    musl_lib_dir_relative_path ++ "src/complex/ccosf.c",
+    musl_lib_dir_relative_path ++ "src/complex/ccosh.c",
+    musl_lib_dir_relative_path ++ "src/complex/ccoshf.c",
+    musl_lib_dir_relative_path ++ "src/complex/ccoshl.c",
+    musl_lib_dir_relative_path ++ "src/complex/ccosl.c",
+    musl_lib_dir_relative_path ++ "src/complex/cexp.c",
+    musl_lib_dir_relative_path ++ "src/complex/cexpf.c",
+    musl_lib_dir_relative_path ++ "src/complex/cexpl.c",
+    musl_lib_dir_relative_path ++ "src/complex/cimag.c",
+    musl_lib_dir_relative_path ++ "src/complex/cimagf.c",
+    musl_lib_dir_relative_path ++ "src/complex/cimagl.c",
+    musl_lib_dir_relative_path ++ "src/complex/clog.c",
+    musl_lib_dir_relative_path ++ "src/complex/clogf.c",
+    musl_lib_dir_relative_path ++ "src/complex/clogl.c",
+    musl_lib_dir_relative_path ++ "src/complex/conj.c",
+    musl_lib_dir_relative_path ++ "src/complex/conjf.c",
+    musl_lib_dir_relative_path ++ "src/complex/conjl.c",
+    musl_lib_dir_relative_path ++ "src/complex/cpow.c",
+    musl_lib_dir_relative_path ++ "src/complex/cpowf.c",
+    musl_lib_dir_relative_path ++ "src/complex/cpowl.c",
+    musl_lib_dir_relative_path ++ "src/complex/cproj.c",
+    musl_lib_dir_relative_path ++ "src/complex/cprojf.c",
+    musl_lib_dir_relative_path ++ "src/complex/cprojl.c",
+    musl_lib_dir_relative_path ++ "src/complex/creal.c",
+    musl_lib_dir_relative_path ++ "src/complex/crealf.c",
+    musl_lib_dir_relative_path ++ "src/complex/creall.c",
+    musl_lib_dir_relative_path ++ "src/complex/csin.c",
+    musl_lib_dir_relative_path ++ "src/complex/csinf.c",
+    musl_lib_dir_relative_path ++ "src/complex/csinh.c",
+    musl_lib_dir_relative_path ++ "src/complex/csinhf.c",
+    musl_lib_dir_relative_path ++ "src/complex/csinhl.c",
+    musl_lib_dir_relative_path ++ "src/complex/csinl.c",
+    musl_lib_dir_relative_path ++ "src/complex/csqrt.c",
+    musl_lib_dir_relative_path ++ "src/complex/csqrtf.c",
+    musl_lib_dir_relative_path ++ "src/complex/csqrtl.c",
+    musl_lib_dir_relative_path ++ "src/complex/ctan.c",
+    musl_lib_dir_relative_path ++ "src/complex/ctanf.c",
+    musl_lib_dir_relative_path ++ "src/complex/ctanh.c",
+    musl_lib_dir_relative_path ++ "src/complex/ctanhf.c",
+    musl_lib_dir_relative_path ++ "src/complex/ctanhl.c",
+    musl_lib_dir_relative_path ++ "src/complex/ctanl.c",
+    musl_lib_dir_relative_path ++ "src/conf/confstr.c",
+    musl_lib_dir_relative_path ++ "src/conf/fpathconf.c",
+    musl_lib_dir_relative_path ++ "src/conf/legacy.c",
+    musl_lib_dir_relative_path ++ "src/conf/pathconf.c",
+    musl_lib_dir_relative_path ++ "src/conf/sysconf.c",
+    musl_lib_dir_relative_path ++ "src/crypt/crypt.c",
+    musl_lib_dir_relative_path ++ "src/crypt/crypt_blowfish.c",
+    musl_lib_dir_relative_path ++ "src/crypt/crypt_des.c",
+    musl_lib_dir_relative_path ++ "src/crypt/crypt_md5.c",
+    musl_lib_dir_relative_path ++ "src/crypt/crypt_r.c",
+    musl_lib_dir_relative_path ++ "src/crypt/crypt_sha256.c",
+    musl_lib_dir_relative_path ++ "src/crypt/crypt_sha512.c",
+    musl_lib_dir_relative_path ++ "src/crypt/encrypt.c",
+    musl_lib_dir_relative_path ++ "src/ctype/__ctype_b_loc.c",
+    musl_lib_dir_relative_path ++ "src/ctype/__ctype_get_mb_cur_max.c",
+    musl_lib_dir_relative_path ++ "src/ctype/__ctype_tolower_loc.c",
+    musl_lib_dir_relative_path ++ "src/ctype/__ctype_toupper_loc.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isalnum.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isalpha.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isascii.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isblank.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iscntrl.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isdigit.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isgraph.c",
+    musl_lib_dir_relative_path ++ "src/ctype/islower.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isprint.c",
+    musl_lib_dir_relative_path ++ "src/ctype/ispunct.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isspace.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isupper.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswalnum.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswalpha.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswblank.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswcntrl.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswctype.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswdigit.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswgraph.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswlower.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswprint.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswpunct.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswspace.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswupper.c",
+    musl_lib_dir_relative_path ++ "src/ctype/iswxdigit.c",
+    musl_lib_dir_relative_path ++ "src/ctype/isxdigit.c",
+    musl_lib_dir_relative_path ++ "src/ctype/toascii.c",
+    musl_lib_dir_relative_path ++ "src/ctype/tolower.c",
+    musl_lib_dir_relative_path ++ "src/ctype/toupper.c",
+    musl_lib_dir_relative_path ++ "src/ctype/towctrans.c",
+    musl_lib_dir_relative_path ++ "src/ctype/wcswidth.c",
+    musl_lib_dir_relative_path ++ "src/ctype/wctrans.c",
+    musl_lib_dir_relative_path ++ "src/ctype/wcwidth.c",
+    musl_lib_dir_relative_path ++ "src/dirent/alphasort.c",
+    musl_lib_dir_relative_path ++ "src/dirent/closedir.c",
+    musl_lib_dir_relative_path ++ "src/dirent/dirfd.c",
+    musl_lib_dir_relative_path ++ "src/dirent/fdopendir.c",
+    musl_lib_dir_relative_path ++ "src/dirent/opendir.c",
+    musl_lib_dir_relative_path ++ "src/dirent/readdir.c",
+    musl_lib_dir_relative_path ++ "src/dirent/readdir_r.c",
+    musl_lib_dir_relative_path ++ "src/dirent/rewinddir.c",
+    musl_lib_dir_relative_path ++ "src/dirent/scandir.c",
+    musl_lib_dir_relative_path ++ "src/dirent/seekdir.c",
+    musl_lib_dir_relative_path ++ "src/dirent/telldir.c",
+    musl_lib_dir_relative_path ++ "src/dirent/versionsort.c",
+    musl_lib_dir_relative_path ++ "src/env/__environ.c",
+    musl_lib_dir_relative_path ++ "src/env/__init_tls.c",
+    musl_lib_dir_relative_path ++ "src/env/__libc_start_main.c",
+    musl_lib_dir_relative_path ++ "src/env/__reset_tls.c",
+    musl_lib_dir_relative_path ++ "src/env/__stack_chk_fail.c",
+    musl_lib_dir_relative_path ++ "src/env/clearenv.c",
+    musl_lib_dir_relative_path ++ "src/env/getenv.c",
+    musl_lib_dir_relative_path ++ "src/env/putenv.c",
+    musl_lib_dir_relative_path ++ "src/env/secure_getenv.c",
+    musl_lib_dir_relative_path ++ "src/env/setenv.c",
+    musl_lib_dir_relative_path ++ "src/env/unsetenv.c",
+    musl_lib_dir_relative_path ++ "src/errno/__errno_location.c",
+    musl_lib_dir_relative_path ++ "src/errno/strerror.c",
+    musl_lib_dir_relative_path ++ "src/exit/_Exit.c",
+    musl_lib_dir_relative_path ++ "src/exit/abort.c",
+    musl_lib_dir_relative_path ++ "src/exit/abort_lock.c",
+    musl_lib_dir_relative_path ++ "src/exit/arm/__aeabi_atexit.c",
+    musl_lib_dir_relative_path ++ "src/exit/assert.c",
+    musl_lib_dir_relative_path ++ "src/exit/at_quick_exit.c",
+    musl_lib_dir_relative_path ++ "src/exit/atexit.c",
+    musl_lib_dir_relative_path ++ "src/exit/exit.c",
+    musl_lib_dir_relative_path ++ "src/exit/quick_exit.c",
+    musl_lib_dir_relative_path ++ "src/fcntl/creat.c",
+    musl_lib_dir_relative_path ++ "src/fcntl/fcntl.c",
+    musl_lib_dir_relative_path ++ "src/fcntl/open.c",
+    musl_lib_dir_relative_path ++ "src/fcntl/openat.c",
+    musl_lib_dir_relative_path ++ "src/fcntl/posix_fadvise.c",
+    musl_lib_dir_relative_path ++ "src/fcntl/posix_fallocate.c",
+    musl_lib_dir_relative_path ++ "src/fenv/__flt_rounds.c",
+    musl_lib_dir_relative_path ++ "src/fenv/fegetexceptflag.c",
+    musl_lib_dir_relative_path ++ "src/fenv/feholdexcept.c",
+    musl_lib_dir_relative_path ++ "src/fenv/fenv.c",
+    musl_lib_dir_relative_path ++ "src/fenv/fesetexceptflag.c",
+    musl_lib_dir_relative_path ++ "src/fenv/fesetround.c",
+    musl_lib_dir_relative_path ++ "src/fenv/feupdateenv.c",
+    musl_lib_dir_relative_path ++ "src/internal/defsysinfo.c",
+    musl_lib_dir_relative_path ++ "src/internal/floatscan.c",
+    musl_lib_dir_relative_path ++ "src/internal/intscan.c",
+    musl_lib_dir_relative_path ++ "src/internal/libc.c",
+    musl_lib_dir_relative_path ++ "src/internal/procfdname.c",
+    musl_lib_dir_relative_path ++ "src/internal/shgetc.c",
+    musl_lib_dir_relative_path ++ "src/internal/syscall_ret.c",
+    musl_lib_dir_relative_path ++ "src/internal/vdso.c",
+    musl_lib_dir_relative_path ++ "src/internal/version.c",
+    musl_lib_dir_relative_path ++ "src/ipc/ftok.c",
+    musl_lib_dir_relative_path ++ "src/ipc/msgctl.c",
+    musl_lib_dir_relative_path ++ "src/ipc/msgget.c",
+    musl_lib_dir_relative_path ++ "src/ipc/msgrcv.c",
+    musl_lib_dir_relative_path ++ "src/ipc/msgsnd.c",
+    musl_lib_dir_relative_path ++ "src/ipc/semctl.c",
+    musl_lib_dir_relative_path ++ "src/ipc/semget.c",
+    musl_lib_dir_relative_path ++ "src/ipc/semop.c",
+    musl_lib_dir_relative_path ++ "src/ipc/semtimedop.c",
+    musl_lib_dir_relative_path ++ "src/ipc/shmat.c",
+    musl_lib_dir_relative_path ++ "src/ipc/shmctl.c",
+    musl_lib_dir_relative_path ++ "src/ipc/shmdt.c",
+    musl_lib_dir_relative_path ++ "src/ipc/shmget.c",
+    musl_lib_dir_relative_path ++ "src/ldso/__dlsym.c",
+    musl_lib_dir_relative_path ++ "src/ldso/dl_iterate_phdr.c",
+    musl_lib_dir_relative_path ++ "src/ldso/dladdr.c",
+    musl_lib_dir_relative_path ++ "src/ldso/dlclose.c",
+    musl_lib_dir_relative_path ++ "src/ldso/dlerror.c",
+    musl_lib_dir_relative_path ++ "src/ldso/dlinfo.c",
+    musl_lib_dir_relative_path ++ "src/ldso/dlopen.c",
+    musl_lib_dir_relative_path ++ "src/ldso/dlsym.c",
+    musl_lib_dir_relative_path ++ "src/legacy/cuserid.c",
+    musl_lib_dir_relative_path ++ "src/legacy/daemon.c",
+    musl_lib_dir_relative_path ++ "src/legacy/err.c",
+    musl_lib_dir_relative_path ++ "src/legacy/euidaccess.c",
+    musl_lib_dir_relative_path ++ "src/legacy/ftw.c",
+    musl_lib_dir_relative_path ++ "src/legacy/futimes.c",
+    musl_lib_dir_relative_path ++ "src/legacy/getdtablesize.c",
+    musl_lib_dir_relative_path ++ "src/legacy/getloadavg.c",
+    musl_lib_dir_relative_path ++ "src/legacy/getpagesize.c",
+    musl_lib_dir_relative_path ++ "src/legacy/getpass.c",
+    musl_lib_dir_relative_path ++ "src/legacy/getusershell.c",
+    musl_lib_dir_relative_path ++ "src/legacy/isastream.c",
+    musl_lib_dir_relative_path ++ "src/legacy/lutimes.c",
+    musl_lib_dir_relative_path ++ "src/legacy/ulimit.c",
+    musl_lib_dir_relative_path ++ "src/legacy/utmpx.c",
+    musl_lib_dir_relative_path ++ "src/legacy/valloc.c",
+    musl_lib_dir_relative_path ++ "src/linux/adjtime.c",
+    musl_lib_dir_relative_path ++ "src/linux/adjtimex.c",
+    musl_lib_dir_relative_path ++ "src/linux/arch_prctl.c",
+    musl_lib_dir_relative_path ++ "src/linux/brk.c",
+    musl_lib_dir_relative_path ++ "src/linux/cache.c",
+    musl_lib_dir_relative_path ++ "src/linux/cap.c",
+    musl_lib_dir_relative_path ++ "src/linux/chroot.c",
+    musl_lib_dir_relative_path ++ "src/linux/clock_adjtime.c",
+    musl_lib_dir_relative_path ++ "src/linux/clone.c",
+    musl_lib_dir_relative_path ++ "src/linux/copy_file_range.c",
+    musl_lib_dir_relative_path ++ "src/linux/epoll.c",
+    musl_lib_dir_relative_path ++ "src/linux/eventfd.c",
+    musl_lib_dir_relative_path ++ "src/linux/fallocate.c",
+    musl_lib_dir_relative_path ++ "src/linux/fanotify.c",
+    musl_lib_dir_relative_path ++ "src/linux/flock.c",
+    musl_lib_dir_relative_path ++ "src/linux/getdents.c",
+    musl_lib_dir_relative_path ++ "src/linux/getrandom.c",
+    musl_lib_dir_relative_path ++ "src/linux/gettid.c",
+    musl_lib_dir_relative_path ++ "src/linux/inotify.c",
+    musl_lib_dir_relative_path ++ "src/linux/ioperm.c",
+    musl_lib_dir_relative_path ++ "src/linux/iopl.c",
+    musl_lib_dir_relative_path ++ "src/linux/klogctl.c",
+    musl_lib_dir_relative_path ++ "src/linux/membarrier.c",
+    musl_lib_dir_relative_path ++ "src/linux/memfd_create.c",
+    musl_lib_dir_relative_path ++ "src/linux/mlock2.c",
+    musl_lib_dir_relative_path ++ "src/linux/module.c",
+    musl_lib_dir_relative_path ++ "src/linux/mount.c",
+    musl_lib_dir_relative_path ++ "src/linux/name_to_handle_at.c",
+    musl_lib_dir_relative_path ++ "src/linux/open_by_handle_at.c",
+    musl_lib_dir_relative_path ++ "src/linux/personality.c",
+    musl_lib_dir_relative_path ++ "src/linux/pivot_root.c",
+    musl_lib_dir_relative_path ++ "src/linux/ppoll.c",
+    musl_lib_dir_relative_path ++ "src/linux/prctl.c",
+    musl_lib_dir_relative_path ++ "src/linux/prlimit.c",
+    musl_lib_dir_relative_path ++ "src/linux/process_vm.c",
+    musl_lib_dir_relative_path ++ "src/linux/ptrace.c",
+    musl_lib_dir_relative_path ++ "src/linux/quotactl.c",
+    musl_lib_dir_relative_path ++ "src/linux/readahead.c",
+    musl_lib_dir_relative_path ++ "src/linux/reboot.c",
+    musl_lib_dir_relative_path ++ "src/linux/remap_file_pages.c",
+    musl_lib_dir_relative_path ++ "src/linux/sbrk.c",
+    musl_lib_dir_relative_path ++ "src/linux/sendfile.c",
+    musl_lib_dir_relative_path ++ "src/linux/setfsgid.c",
+    musl_lib_dir_relative_path ++ "src/linux/setfsuid.c",
+    musl_lib_dir_relative_path ++ "src/linux/setgroups.c",
+    musl_lib_dir_relative_path ++ "src/linux/sethostname.c",
+    musl_lib_dir_relative_path ++ "src/linux/setns.c",
+    musl_lib_dir_relative_path ++ "src/linux/settimeofday.c",
+    musl_lib_dir_relative_path ++ "src/linux/signalfd.c",
+    musl_lib_dir_relative_path ++ "src/linux/splice.c",
+    musl_lib_dir_relative_path ++ "src/linux/stime.c",
+    musl_lib_dir_relative_path ++ "src/linux/swap.c",
+    musl_lib_dir_relative_path ++ "src/linux/sync_file_range.c",
+    musl_lib_dir_relative_path ++ "src/linux/syncfs.c",
+    musl_lib_dir_relative_path ++ "src/linux/sysinfo.c",
+    musl_lib_dir_relative_path ++ "src/linux/tee.c",
+    musl_lib_dir_relative_path ++ "src/linux/timerfd.c",
+    musl_lib_dir_relative_path ++ "src/linux/unshare.c",
+    musl_lib_dir_relative_path ++ "src/linux/utimes.c",
+    musl_lib_dir_relative_path ++ "src/linux/vhangup.c",
+    musl_lib_dir_relative_path ++ "src/linux/vmsplice.c",
+    musl_lib_dir_relative_path ++ "src/linux/wait3.c",
+    musl_lib_dir_relative_path ++ "src/linux/wait4.c",
+    musl_lib_dir_relative_path ++ "src/linux/xattr.c",
+    musl_lib_dir_relative_path ++ "src/locale/__lctrans.c",
+    musl_lib_dir_relative_path ++ "src/locale/__mo_lookup.c",
+    musl_lib_dir_relative_path ++ "src/locale/bind_textdomain_codeset.c",
+    musl_lib_dir_relative_path ++ "src/locale/c_locale.c",
+    musl_lib_dir_relative_path ++ "src/locale/catclose.c",
+    musl_lib_dir_relative_path ++ "src/locale/catgets.c",
+    musl_lib_dir_relative_path ++ "src/locale/catopen.c",
+    musl_lib_dir_relative_path ++ "src/locale/dcngettext.c",
+    musl_lib_dir_relative_path ++ "src/locale/duplocale.c",
+    musl_lib_dir_relative_path ++ "src/locale/freelocale.c",
+    musl_lib_dir_relative_path ++ "src/locale/iconv.c",
+    musl_lib_dir_relative_path ++ "src/locale/iconv_close.c",
+    musl_lib_dir_relative_path ++ "src/locale/langinfo.c",
+    musl_lib_dir_relative_path ++ "src/locale/locale_map.c",
+    musl_lib_dir_relative_path ++ "src/locale/localeconv.c",
+    musl_lib_dir_relative_path ++ "src/locale/newlocale.c",
+    musl_lib_dir_relative_path ++ "src/locale/pleval.c",
+    musl_lib_dir_relative_path ++ "src/locale/setlocale.c",
+    musl_lib_dir_relative_path ++ "src/locale/strcoll.c",
+    musl_lib_dir_relative_path ++ "src/locale/strfmon.c",
+    musl_lib_dir_relative_path ++ "src/locale/strtod_l.c",
+    musl_lib_dir_relative_path ++ "src/locale/strxfrm.c",
+    musl_lib_dir_relative_path ++ "src/locale/textdomain.c",
+    musl_lib_dir_relative_path ++ "src/locale/uselocale.c",
+    musl_lib_dir_relative_path ++ "src/locale/wcscoll.c",
+    musl_lib_dir_relative_path ++ "src/locale/wcsxfrm.c",
+    musl_lib_dir_relative_path ++ "src/malloc/calloc.c",
+    musl_lib_dir_relative_path ++ "src/malloc/free.c",
+    musl_lib_dir_relative_path ++ "src/malloc/libc_calloc.c",
+    musl_lib_dir_relative_path ++ "src/malloc/lite_malloc.c",
+    musl_lib_dir_relative_path ++ "src/malloc/mallocng/aligned_alloc.c",
+    musl_lib_dir_relative_path ++ "src/malloc/mallocng/donate.c",
+    musl_lib_dir_relative_path ++ "src/malloc/mallocng/free.c",
+    musl_lib_dir_relative_path ++ "src/malloc/mallocng/malloc.c",
+    musl_lib_dir_relative_path ++ "src/malloc/mallocng/malloc_usable_size.c",
+    musl_lib_dir_relative_path ++ "src/malloc/mallocng/realloc.c",
+    musl_lib_dir_relative_path ++ "src/malloc/memalign.c",
+    musl_lib_dir_relative_path ++ "src/malloc/oldmalloc/aligned_alloc.c",
+    musl_lib_dir_relative_path ++ "src/malloc/oldmalloc/malloc.c",
+    musl_lib_dir_relative_path ++ "src/malloc/oldmalloc/malloc_usable_size.c",
+    musl_lib_dir_relative_path ++ "src/malloc/posix_memalign.c",
+    musl_lib_dir_relative_path ++ "src/malloc/realloc.c",
+    musl_lib_dir_relative_path ++ "src/malloc/reallocarray.c",
+    musl_lib_dir_relative_path ++ "src/malloc/replaced.c",
+    musl_lib_dir_relative_path ++ "src/math/__cos.c",
+    musl_lib_dir_relative_path ++ "src/math/__cosdf.c",
+    musl_lib_dir_relative_path ++ "src/math/__cosl.c",
+    musl_lib_dir_relative_path ++ "src/math/__expo2.c",
+    musl_lib_dir_relative_path ++ "src/math/__expo2f.c",
+    musl_lib_dir_relative_path ++ "src/math/__fpclassify.c",
+    musl_lib_dir_relative_path ++ "src/math/__fpclassifyf.c",
+    musl_lib_dir_relative_path ++ "src/math/__fpclassifyl.c",
+    musl_lib_dir_relative_path ++ "src/math/__invtrigl.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_divzero.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_divzerof.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_invalid.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_invalidf.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_invalidl.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_oflow.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_oflowf.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_uflow.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_uflowf.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_xflow.c",
+    musl_lib_dir_relative_path ++ "src/math/__math_xflowf.c",
+    musl_lib_dir_relative_path ++ "src/math/__polevll.c",
+    musl_lib_dir_relative_path ++ "src/math/__rem_pio2.c",
+    musl_lib_dir_relative_path ++ "src/math/__rem_pio2_large.c",
+    musl_lib_dir_relative_path ++ "src/math/__rem_pio2f.c",
+    musl_lib_dir_relative_path ++ "src/math/__rem_pio2l.c",
+    musl_lib_dir_relative_path ++ "src/math/__signbit.c",
+    musl_lib_dir_relative_path ++ "src/math/__signbitf.c",
+    musl_lib_dir_relative_path ++ "src/math/__signbitl.c",
+    musl_lib_dir_relative_path ++ "src/math/__sin.c",
+    musl_lib_dir_relative_path ++ "src/math/__sindf.c",
+    musl_lib_dir_relative_path ++ "src/math/__sinl.c",
+    musl_lib_dir_relative_path ++ "src/math/__tan.c",
+    musl_lib_dir_relative_path ++ "src/math/__tandf.c",
+    musl_lib_dir_relative_path ++ "src/math/__tanl.c",
+    musl_lib_dir_relative_path ++ "src/math/acos.c",
+    musl_lib_dir_relative_path ++ "src/math/acosf.c",
+    musl_lib_dir_relative_path ++ "src/math/acosh.c",
+    musl_lib_dir_relative_path ++ "src/math/acoshf.c",
+    musl_lib_dir_relative_path ++ "src/math/acoshl.c",
+    musl_lib_dir_relative_path ++ "src/math/acosl.c",
+    musl_lib_dir_relative_path ++ "src/math/asin.c",
+    musl_lib_dir_relative_path ++ "src/math/asinf.c",
+    musl_lib_dir_relative_path ++ "src/math/asinh.c",
+    musl_lib_dir_relative_path ++ "src/math/asinhf.c",
+    musl_lib_dir_relative_path ++ "src/math/asinhl.c",
+    musl_lib_dir_relative_path ++ "src/math/asinl.c",
+    musl_lib_dir_relative_path ++ "src/math/atan.c",
+    musl_lib_dir_relative_path ++ "src/math/atan2.c",
+    musl_lib_dir_relative_path ++ "src/math/atan2f.c",
+    musl_lib_dir_relative_path ++ "src/math/atan2l.c",
+    musl_lib_dir_relative_path ++ "src/math/atanf.c",
+    musl_lib_dir_relative_path ++ "src/math/atanh.c",
+    musl_lib_dir_relative_path ++ "src/math/atanhf.c",
+    musl_lib_dir_relative_path ++ "src/math/atanhl.c",
+    musl_lib_dir_relative_path ++ "src/math/atanl.c",
+    musl_lib_dir_relative_path ++ "src/math/cbrt.c",
+    musl_lib_dir_relative_path ++ "src/math/cbrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/cbrtl.c",
+    musl_lib_dir_relative_path ++ "src/math/ceil.c",
+    musl_lib_dir_relative_path ++ "src/math/ceilf.c",
+    musl_lib_dir_relative_path ++ "src/math/ceill.c",
+    musl_lib_dir_relative_path ++ "src/math/copysign.c",
+    musl_lib_dir_relative_path ++ "src/math/copysignf.c",
+    musl_lib_dir_relative_path ++ "src/math/copysignl.c",
+    musl_lib_dir_relative_path ++ "src/math/cos.c",
+    musl_lib_dir_relative_path ++ "src/math/cosf.c",
+    musl_lib_dir_relative_path ++ "src/math/cosh.c",
+    musl_lib_dir_relative_path ++ "src/math/coshf.c",
+    musl_lib_dir_relative_path ++ "src/math/coshl.c",
+    musl_lib_dir_relative_path ++ "src/math/cosl.c",
+    musl_lib_dir_relative_path ++ "src/math/erf.c",
+    musl_lib_dir_relative_path ++ "src/math/erff.c",
+    musl_lib_dir_relative_path ++ "src/math/erfl.c",
+    musl_lib_dir_relative_path ++ "src/math/exp.c",
+    musl_lib_dir_relative_path ++ "src/math/exp10.c",
+    musl_lib_dir_relative_path ++ "src/math/exp10f.c",
+    musl_lib_dir_relative_path ++ "src/math/exp10l.c",
+    musl_lib_dir_relative_path ++ "src/math/exp2.c",
+    musl_lib_dir_relative_path ++ "src/math/exp2f.c",
+    musl_lib_dir_relative_path ++ "src/math/exp2f_data.c",
+    musl_lib_dir_relative_path ++ "src/math/exp2l.c",
+    musl_lib_dir_relative_path ++ "src/math/exp_data.c",
+    musl_lib_dir_relative_path ++ "src/math/expf.c",
+    musl_lib_dir_relative_path ++ "src/math/expl.c",
+    musl_lib_dir_relative_path ++ "src/math/expm1.c",
+    musl_lib_dir_relative_path ++ "src/math/expm1f.c",
+    musl_lib_dir_relative_path ++ "src/math/expm1l.c",
+    musl_lib_dir_relative_path ++ "src/math/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/fabsl.c",
+    musl_lib_dir_relative_path ++ "src/math/fdim.c",
+    musl_lib_dir_relative_path ++ "src/math/fdimf.c",
+    musl_lib_dir_relative_path ++ "src/math/fdiml.c",
+    musl_lib_dir_relative_path ++ "src/math/finite.c",
+    musl_lib_dir_relative_path ++ "src/math/finitef.c",
+    musl_lib_dir_relative_path ++ "src/math/floor.c",
+    musl_lib_dir_relative_path ++ "src/math/floorf.c",
+    musl_lib_dir_relative_path ++ "src/math/floorl.c",
+    musl_lib_dir_relative_path ++ "src/math/fma.c",
+    musl_lib_dir_relative_path ++ "src/math/fmaf.c",
+    musl_lib_dir_relative_path ++ "src/math/fmal.c",
+    musl_lib_dir_relative_path ++ "src/math/fmax.c",
+    musl_lib_dir_relative_path ++ "src/math/fmaxf.c",
+    musl_lib_dir_relative_path ++ "src/math/fmaxl.c",
+    musl_lib_dir_relative_path ++ "src/math/fmin.c",
+    musl_lib_dir_relative_path ++ "src/math/fminf.c",
+    musl_lib_dir_relative_path ++ "src/math/fminl.c",
+    musl_lib_dir_relative_path ++ "src/math/fmod.c",
+    musl_lib_dir_relative_path ++ "src/math/fmodf.c",
+    musl_lib_dir_relative_path ++ "src/math/fmodl.c",
+    musl_lib_dir_relative_path ++ "src/math/frexp.c",
+    musl_lib_dir_relative_path ++ "src/math/frexpf.c",
+    musl_lib_dir_relative_path ++ "src/math/frexpl.c",
+    musl_lib_dir_relative_path ++ "src/math/hypot.c",
+    musl_lib_dir_relative_path ++ "src/math/hypotf.c",
+    musl_lib_dir_relative_path ++ "src/math/hypotl.c",
+    musl_lib_dir_relative_path ++ "src/math/ilogb.c",
+    musl_lib_dir_relative_path ++ "src/math/ilogbf.c",
+    musl_lib_dir_relative_path ++ "src/math/ilogbl.c",
+    musl_lib_dir_relative_path ++ "src/math/j0.c",
+    musl_lib_dir_relative_path ++ "src/math/j0f.c",
+    musl_lib_dir_relative_path ++ "src/math/j1.c",
+    musl_lib_dir_relative_path ++ "src/math/j1f.c",
+    musl_lib_dir_relative_path ++ "src/math/jn.c",
+    musl_lib_dir_relative_path ++ "src/math/jnf.c",
+    musl_lib_dir_relative_path ++ "src/math/ldexp.c",
+    musl_lib_dir_relative_path ++ "src/math/ldexpf.c",
+    musl_lib_dir_relative_path ++ "src/math/ldexpl.c",
+    musl_lib_dir_relative_path ++ "src/math/lgamma.c",
+    musl_lib_dir_relative_path ++ "src/math/lgamma_r.c",
+    musl_lib_dir_relative_path ++ "src/math/lgammaf.c",
+    musl_lib_dir_relative_path ++ "src/math/lgammaf_r.c",
+    musl_lib_dir_relative_path ++ "src/math/lgammal.c",
+    musl_lib_dir_relative_path ++ "src/math/llrint.c",
+    musl_lib_dir_relative_path ++ "src/math/llrintf.c",
+    musl_lib_dir_relative_path ++ "src/math/llrintl.c",
+    musl_lib_dir_relative_path ++ "src/math/llround.c",
+    musl_lib_dir_relative_path ++ "src/math/llroundf.c",
+    musl_lib_dir_relative_path ++ "src/math/llroundl.c",
+    musl_lib_dir_relative_path ++ "src/math/log.c",
+    musl_lib_dir_relative_path ++ "src/math/log10.c",
+    musl_lib_dir_relative_path ++ "src/math/log10f.c",
+    musl_lib_dir_relative_path ++ "src/math/log10l.c",
+    musl_lib_dir_relative_path ++ "src/math/log1p.c",
+    musl_lib_dir_relative_path ++ "src/math/log1pf.c",
+    musl_lib_dir_relative_path ++ "src/math/log1pl.c",
+    musl_lib_dir_relative_path ++ "src/math/log2.c",
+    musl_lib_dir_relative_path ++ "src/math/log2_data.c",
+    musl_lib_dir_relative_path ++ "src/math/log2f.c",
+    musl_lib_dir_relative_path ++ "src/math/log2f_data.c",
+    musl_lib_dir_relative_path ++ "src/math/log2l.c",
+    musl_lib_dir_relative_path ++ "src/math/log_data.c",
+    musl_lib_dir_relative_path ++ "src/math/logb.c",
+    musl_lib_dir_relative_path ++ "src/math/logbf.c",
+    musl_lib_dir_relative_path ++ "src/math/logbl.c",
+    musl_lib_dir_relative_path ++ "src/math/logf.c",
+    musl_lib_dir_relative_path ++ "src/math/logf_data.c",
+    musl_lib_dir_relative_path ++ "src/math/logl.c",
+    musl_lib_dir_relative_path ++ "src/math/lrint.c",
+    musl_lib_dir_relative_path ++ "src/math/lrintf.c",
+    musl_lib_dir_relative_path ++ "src/math/lrintl.c",
+    musl_lib_dir_relative_path ++ "src/math/lround.c",
+    musl_lib_dir_relative_path ++ "src/math/lroundf.c",
+    musl_lib_dir_relative_path ++ "src/math/lroundl.c",
+    musl_lib_dir_relative_path ++ "src/math/modf.c",
+    musl_lib_dir_relative_path ++ "src/math/modff.c",
+    musl_lib_dir_relative_path ++ "src/math/modfl.c",
+    musl_lib_dir_relative_path ++ "src/math/nan.c",
+    musl_lib_dir_relative_path ++ "src/math/nanf.c",
+    musl_lib_dir_relative_path ++ "src/math/nanl.c",
+    musl_lib_dir_relative_path ++ "src/math/nearbyint.c",
+    musl_lib_dir_relative_path ++ "src/math/nearbyintf.c",
+    musl_lib_dir_relative_path ++ "src/math/nearbyintl.c",
+    musl_lib_dir_relative_path ++ "src/math/nextafter.c",
+    musl_lib_dir_relative_path ++ "src/math/nextafterf.c",
+    musl_lib_dir_relative_path ++ "src/math/nextafterl.c",
+    musl_lib_dir_relative_path ++ "src/math/nexttoward.c",
+    musl_lib_dir_relative_path ++ "src/math/nexttowardf.c",
+    musl_lib_dir_relative_path ++ "src/math/nexttowardl.c",
+    musl_lib_dir_relative_path ++ "src/math/pow.c",
+    musl_lib_dir_relative_path ++ "src/math/pow_data.c",
+    musl_lib_dir_relative_path ++ "src/math/powf.c",
+    musl_lib_dir_relative_path ++ "src/math/powf_data.c",
+    musl_lib_dir_relative_path ++ "src/math/powl.c",
+    musl_lib_dir_relative_path ++ "src/math/remainder.c",
+    musl_lib_dir_relative_path ++ "src/math/remainderf.c",
+    musl_lib_dir_relative_path ++ "src/math/remainderl.c",
+    musl_lib_dir_relative_path ++ "src/math/remquo.c",
+    musl_lib_dir_relative_path ++ "src/math/remquof.c",
+    musl_lib_dir_relative_path ++ "src/math/remquol.c",
+    musl_lib_dir_relative_path ++ "src/math/rint.c",
+    musl_lib_dir_relative_path ++ "src/math/rintf.c",
+    musl_lib_dir_relative_path ++ "src/math/rintl.c",
+    musl_lib_dir_relative_path ++ "src/math/round.c",
+    musl_lib_dir_relative_path ++ "src/math/roundf.c",
+    musl_lib_dir_relative_path ++ "src/math/roundl.c",
+    musl_lib_dir_relative_path ++ "src/math/scalb.c",
+    musl_lib_dir_relative_path ++ "src/math/scalbf.c",
+    musl_lib_dir_relative_path ++ "src/math/scalbln.c",
+    musl_lib_dir_relative_path ++ "src/math/scalblnf.c",
+    musl_lib_dir_relative_path ++ "src/math/scalblnl.c",
+    musl_lib_dir_relative_path ++ "src/math/scalbn.c",
+    musl_lib_dir_relative_path ++ "src/math/scalbnf.c",
+    musl_lib_dir_relative_path ++ "src/math/scalbnl.c",
+    musl_lib_dir_relative_path ++ "src/math/signgam.c",
+    musl_lib_dir_relative_path ++ "src/math/significand.c",
+    musl_lib_dir_relative_path ++ "src/math/significandf.c",
+    musl_lib_dir_relative_path ++ "src/math/sin.c",
+    musl_lib_dir_relative_path ++ "src/math/sincos.c",
+    musl_lib_dir_relative_path ++ "src/math/sincosf.c",
+    musl_lib_dir_relative_path ++ "src/math/sincosl.c",
+    musl_lib_dir_relative_path ++ "src/math/sinf.c",
+    musl_lib_dir_relative_path ++ "src/math/sinh.c",
+    musl_lib_dir_relative_path ++ "src/math/sinhf.c",
+    musl_lib_dir_relative_path ++ "src/math/sinhl.c",
+    musl_lib_dir_relative_path ++ "src/math/sinl.c",
+    musl_lib_dir_relative_path ++ "src/math/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/sqrt_data.c",
+    musl_lib_dir_relative_path ++ "src/math/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/sqrtl.c",
+    musl_lib_dir_relative_path ++ "src/math/tan.c",
+    musl_lib_dir_relative_path ++ "src/math/tanf.c",
+    musl_lib_dir_relative_path ++ "src/math/tanh.c",
+    musl_lib_dir_relative_path ++ "src/math/tanhf.c",
+    musl_lib_dir_relative_path ++ "src/math/tanhl.c",
+    musl_lib_dir_relative_path ++ "src/math/tanl.c",
+    musl_lib_dir_relative_path ++ "src/math/tgamma.c",
+    musl_lib_dir_relative_path ++ "src/math/tgammaf.c",
+    musl_lib_dir_relative_path ++ "src/math/tgammal.c",
+    musl_lib_dir_relative_path ++ "src/math/trunc.c",
+    musl_lib_dir_relative_path ++ "src/math/truncf.c",
+    musl_lib_dir_relative_path ++ "src/math/truncl.c",
+    musl_lib_dir_relative_path ++ "src/misc/a64l.c",
+    musl_lib_dir_relative_path ++ "src/misc/basename.c",
+    musl_lib_dir_relative_path ++ "src/misc/dirname.c",
+    musl_lib_dir_relative_path ++ "src/misc/ffs.c",
+    musl_lib_dir_relative_path ++ "src/misc/ffsl.c",
+    musl_lib_dir_relative_path ++ "src/misc/ffsll.c",
+    musl_lib_dir_relative_path ++ "src/misc/fmtmsg.c",
+    musl_lib_dir_relative_path ++ "src/misc/forkpty.c",
+    musl_lib_dir_relative_path ++ "src/misc/get_current_dir_name.c",
+    musl_lib_dir_relative_path ++ "src/misc/getauxval.c",
+    musl_lib_dir_relative_path ++ "src/misc/getdomainname.c",
+    musl_lib_dir_relative_path ++ "src/misc/getentropy.c",
+    musl_lib_dir_relative_path ++ "src/misc/gethostid.c",
+    musl_lib_dir_relative_path ++ "src/misc/getopt.c",
+    musl_lib_dir_relative_path ++ "src/misc/getopt_long.c",
+    musl_lib_dir_relative_path ++ "src/misc/getpriority.c",
+    musl_lib_dir_relative_path ++ "src/misc/getresgid.c",
+    musl_lib_dir_relative_path ++ "src/misc/getresuid.c",
+    musl_lib_dir_relative_path ++ "src/misc/getrlimit.c",
+    musl_lib_dir_relative_path ++ "src/misc/getrusage.c",
+    musl_lib_dir_relative_path ++ "src/misc/getsubopt.c",
+    musl_lib_dir_relative_path ++ "src/misc/initgroups.c",
+    musl_lib_dir_relative_path ++ "src/misc/ioctl.c",
+    musl_lib_dir_relative_path ++ "src/misc/issetugid.c",
+    musl_lib_dir_relative_path ++ "src/misc/lockf.c",
+    musl_lib_dir_relative_path ++ "src/misc/login_tty.c",
+    musl_lib_dir_relative_path ++ "src/misc/mntent.c",
+    musl_lib_dir_relative_path ++ "src/misc/nftw.c",
+    musl_lib_dir_relative_path ++ "src/misc/openpty.c",
+    musl_lib_dir_relative_path ++ "src/misc/ptsname.c",
+    musl_lib_dir_relative_path ++ "src/misc/pty.c",
+    musl_lib_dir_relative_path ++ "src/misc/realpath.c",
+    musl_lib_dir_relative_path ++ "src/misc/setdomainname.c",
+    musl_lib_dir_relative_path ++ "src/misc/setpriority.c",
+    musl_lib_dir_relative_path ++ "src/misc/setrlimit.c",
+    musl_lib_dir_relative_path ++ "src/misc/syscall.c",
+    musl_lib_dir_relative_path ++ "src/misc/syslog.c",
+    musl_lib_dir_relative_path ++ "src/misc/uname.c",
+    musl_lib_dir_relative_path ++ "src/misc/wordexp.c",
+    musl_lib_dir_relative_path ++ "src/mman/madvise.c",
+    musl_lib_dir_relative_path ++ "src/mman/mincore.c",
+    musl_lib_dir_relative_path ++ "src/mman/mlock.c",
+    musl_lib_dir_relative_path ++ "src/mman/mlockall.c",
+    musl_lib_dir_relative_path ++ "src/mman/mmap.c",
+    musl_lib_dir_relative_path ++ "src/mman/mprotect.c",
+    musl_lib_dir_relative_path ++ "src/mman/mremap.c",
+    musl_lib_dir_relative_path ++ "src/mman/msync.c",
+    musl_lib_dir_relative_path ++ "src/mman/munlock.c",
+    musl_lib_dir_relative_path ++ "src/mman/munlockall.c",
+    musl_lib_dir_relative_path ++ "src/mman/munmap.c",
+    musl_lib_dir_relative_path ++ "src/mman/posix_madvise.c",
+    musl_lib_dir_relative_path ++ "src/mman/shm_open.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_close.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_getattr.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_notify.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_open.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_receive.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_send.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_setattr.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_timedreceive.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_timedsend.c",
+    musl_lib_dir_relative_path ++ "src/mq/mq_unlink.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/btowc.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/c16rtomb.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/c32rtomb.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/internal.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mblen.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mbrlen.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mbrtoc16.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mbrtoc32.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mbrtowc.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mbsinit.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mbsnrtowcs.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mbsrtowcs.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mbstowcs.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/mbtowc.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/wcrtomb.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/wcsnrtombs.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/wcsrtombs.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/wcstombs.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/wctob.c",
+    musl_lib_dir_relative_path ++ "src/multibyte/wctomb.c",
+    musl_lib_dir_relative_path ++ "src/network/accept.c",
+    musl_lib_dir_relative_path ++ "src/network/accept4.c",
+    musl_lib_dir_relative_path ++ "src/network/bind.c",
+    musl_lib_dir_relative_path ++ "src/network/connect.c",
+    musl_lib_dir_relative_path ++ "src/network/dn_comp.c",
+    musl_lib_dir_relative_path ++ "src/network/dn_expand.c",
+    musl_lib_dir_relative_path ++ "src/network/dn_skipname.c",
+    musl_lib_dir_relative_path ++ "src/network/dns_parse.c",
+    musl_lib_dir_relative_path ++ "src/network/ent.c",
+    musl_lib_dir_relative_path ++ "src/network/ether.c",
+    musl_lib_dir_relative_path ++ "src/network/freeaddrinfo.c",
+    musl_lib_dir_relative_path ++ "src/network/gai_strerror.c",
+    musl_lib_dir_relative_path ++ "src/network/getaddrinfo.c",
+    musl_lib_dir_relative_path ++ "src/network/gethostbyaddr.c",
+    musl_lib_dir_relative_path ++ "src/network/gethostbyaddr_r.c",
+    musl_lib_dir_relative_path ++ "src/network/gethostbyname.c",
+    musl_lib_dir_relative_path ++ "src/network/gethostbyname2.c",
+    musl_lib_dir_relative_path ++ "src/network/gethostbyname2_r.c",
+    musl_lib_dir_relative_path ++ "src/network/gethostbyname_r.c",
+    musl_lib_dir_relative_path ++ "src/network/getifaddrs.c",
+    musl_lib_dir_relative_path ++ "src/network/getnameinfo.c",
+    musl_lib_dir_relative_path ++ "src/network/getpeername.c",
+    musl_lib_dir_relative_path ++ "src/network/getservbyname.c",
+    musl_lib_dir_relative_path ++ "src/network/getservbyname_r.c",
+    musl_lib_dir_relative_path ++ "src/network/getservbyport.c",
+    musl_lib_dir_relative_path ++ "src/network/getservbyport_r.c",
+    musl_lib_dir_relative_path ++ "src/network/getsockname.c",
+    musl_lib_dir_relative_path ++ "src/network/getsockopt.c",
+    musl_lib_dir_relative_path ++ "src/network/h_errno.c",
+    musl_lib_dir_relative_path ++ "src/network/herror.c",
+    musl_lib_dir_relative_path ++ "src/network/hstrerror.c",
+    musl_lib_dir_relative_path ++ "src/network/htonl.c",
+    musl_lib_dir_relative_path ++ "src/network/htons.c",
+    musl_lib_dir_relative_path ++ "src/network/if_freenameindex.c",
+    musl_lib_dir_relative_path ++ "src/network/if_indextoname.c",
+    musl_lib_dir_relative_path ++ "src/network/if_nameindex.c",
+    musl_lib_dir_relative_path ++ "src/network/if_nametoindex.c",
+    musl_lib_dir_relative_path ++ "src/network/in6addr_any.c",
+    musl_lib_dir_relative_path ++ "src/network/in6addr_loopback.c",
+    musl_lib_dir_relative_path ++ "src/network/inet_addr.c",
+    musl_lib_dir_relative_path ++ "src/network/inet_aton.c",
+    musl_lib_dir_relative_path ++ "src/network/inet_legacy.c",
+    musl_lib_dir_relative_path ++ "src/network/inet_ntoa.c",
+    musl_lib_dir_relative_path ++ "src/network/inet_ntop.c",
+    musl_lib_dir_relative_path ++ "src/network/inet_pton.c",
+    musl_lib_dir_relative_path ++ "src/network/listen.c",
+    musl_lib_dir_relative_path ++ "src/network/lookup_ipliteral.c",
+    musl_lib_dir_relative_path ++ "src/network/lookup_name.c",
+    musl_lib_dir_relative_path ++ "src/network/lookup_serv.c",
+    musl_lib_dir_relative_path ++ "src/network/netlink.c",
+    musl_lib_dir_relative_path ++ "src/network/netname.c",
+    musl_lib_dir_relative_path ++ "src/network/ns_parse.c",
+    musl_lib_dir_relative_path ++ "src/network/ntohl.c",
+    musl_lib_dir_relative_path ++ "src/network/ntohs.c",
+    musl_lib_dir_relative_path ++ "src/network/proto.c",
+    musl_lib_dir_relative_path ++ "src/network/recv.c",
+    musl_lib_dir_relative_path ++ "src/network/recvfrom.c",
+    musl_lib_dir_relative_path ++ "src/network/recvmmsg.c",
+    musl_lib_dir_relative_path ++ "src/network/recvmsg.c",
+    musl_lib_dir_relative_path ++ "src/network/res_init.c",
+    musl_lib_dir_relative_path ++ "src/network/res_mkquery.c",
+    musl_lib_dir_relative_path ++ "src/network/res_msend.c",
+    musl_lib_dir_relative_path ++ "src/network/res_query.c",
+    musl_lib_dir_relative_path ++ "src/network/res_querydomain.c",
+    musl_lib_dir_relative_path ++ "src/network/res_send.c",
+    musl_lib_dir_relative_path ++ "src/network/res_state.c",
+    musl_lib_dir_relative_path ++ "src/network/resolvconf.c",
+    musl_lib_dir_relative_path ++ "src/network/send.c",
+    musl_lib_dir_relative_path ++ "src/network/sendmmsg.c",
+    musl_lib_dir_relative_path ++ "src/network/sendmsg.c",
+    musl_lib_dir_relative_path ++ "src/network/sendto.c",
+    musl_lib_dir_relative_path ++ "src/network/serv.c",
+    musl_lib_dir_relative_path ++ "src/network/setsockopt.c",
+    musl_lib_dir_relative_path ++ "src/network/shutdown.c",
+    musl_lib_dir_relative_path ++ "src/network/sockatmark.c",
+    musl_lib_dir_relative_path ++ "src/network/socket.c",
+    musl_lib_dir_relative_path ++ "src/network/socketpair.c",
+    musl_lib_dir_relative_path ++ "src/passwd/fgetgrent.c",
+    musl_lib_dir_relative_path ++ "src/passwd/fgetpwent.c",
+    musl_lib_dir_relative_path ++ "src/passwd/fgetspent.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getgr_a.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getgr_r.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getgrent.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getgrent_a.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getgrouplist.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getpw_a.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getpw_r.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getpwent.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getpwent_a.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getspent.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getspnam.c",
+    musl_lib_dir_relative_path ++ "src/passwd/getspnam_r.c",
+    musl_lib_dir_relative_path ++ "src/passwd/lckpwdf.c",
+    musl_lib_dir_relative_path ++ "src/passwd/nscd_query.c",
+    musl_lib_dir_relative_path ++ "src/passwd/putgrent.c",
+    musl_lib_dir_relative_path ++ "src/passwd/putpwent.c",
+    musl_lib_dir_relative_path ++ "src/passwd/putspent.c",
+    musl_lib_dir_relative_path ++ "src/prng/__rand48_step.c",
+    musl_lib_dir_relative_path ++ "src/prng/__seed48.c",
+    musl_lib_dir_relative_path ++ "src/prng/drand48.c",
+    musl_lib_dir_relative_path ++ "src/prng/lcong48.c",
+    musl_lib_dir_relative_path ++ "src/prng/lrand48.c",
+    musl_lib_dir_relative_path ++ "src/prng/mrand48.c",
+    musl_lib_dir_relative_path ++ "src/prng/rand.c",
+    musl_lib_dir_relative_path ++ "src/prng/rand_r.c",
+    musl_lib_dir_relative_path ++ "src/prng/random.c",
+    musl_lib_dir_relative_path ++ "src/prng/seed48.c",
+    musl_lib_dir_relative_path ++ "src/prng/srand48.c",
+    musl_lib_dir_relative_path ++ "src/process/_Fork.c",
+    musl_lib_dir_relative_path ++ "src/process/execl.c",
+    musl_lib_dir_relative_path ++ "src/process/execle.c",
+    musl_lib_dir_relative_path ++ "src/process/execlp.c",
+    musl_lib_dir_relative_path ++ "src/process/execv.c",
+    musl_lib_dir_relative_path ++ "src/process/execve.c",
+    musl_lib_dir_relative_path ++ "src/process/execvp.c",
+    musl_lib_dir_relative_path ++ "src/process/fexecve.c",
+    musl_lib_dir_relative_path ++ "src/process/fork.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawn.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawn_file_actions_addchdir.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawn_file_actions_addclose.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawn_file_actions_adddup2.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawn_file_actions_addfchdir.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawn_file_actions_addopen.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawn_file_actions_destroy.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawn_file_actions_init.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_destroy.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_getflags.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_getpgroup.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_getsigdefault.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_getsigmask.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_init.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_sched.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_setflags.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_setpgroup.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_setsigdefault.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnattr_setsigmask.c",
+    musl_lib_dir_relative_path ++ "src/process/posix_spawnp.c",
+    musl_lib_dir_relative_path ++ "src/regex/fnmatch.c",
+    musl_lib_dir_relative_path ++ "src/regex/glob.c",
+    musl_lib_dir_relative_path ++ "src/regex/regcomp.c",
+    musl_lib_dir_relative_path ++ "src/regex/regerror.c",
+    musl_lib_dir_relative_path ++ "src/regex/regexec.c",
+    musl_lib_dir_relative_path ++ "src/regex/tre-mem.c",
+    musl_lib_dir_relative_path ++ "src/sched/affinity.c",
+    musl_lib_dir_relative_path ++ "src/sched/sched_cpucount.c",
+    musl_lib_dir_relative_path ++ "src/sched/sched_get_priority_max.c",
+    musl_lib_dir_relative_path ++ "src/sched/sched_getcpu.c",
+    musl_lib_dir_relative_path ++ "src/sched/sched_getparam.c",
+    musl_lib_dir_relative_path ++ "src/sched/sched_getscheduler.c",
+    musl_lib_dir_relative_path ++ "src/sched/sched_rr_get_interval.c",
+    musl_lib_dir_relative_path ++ "src/sched/sched_setparam.c",
+    musl_lib_dir_relative_path ++ "src/sched/sched_setscheduler.c",
+    musl_lib_dir_relative_path ++ "src/sched/sched_yield.c",
+    musl_lib_dir_relative_path ++ "src/search/hsearch.c",
+    musl_lib_dir_relative_path ++ "src/search/insque.c",
+    musl_lib_dir_relative_path ++ "src/search/lsearch.c",
+    musl_lib_dir_relative_path ++ "src/search/tdelete.c",
+    musl_lib_dir_relative_path ++ "src/search/tdestroy.c",
+    musl_lib_dir_relative_path ++ "src/search/tfind.c",
+    musl_lib_dir_relative_path ++ "src/search/tsearch.c",
+    musl_lib_dir_relative_path ++ "src/search/twalk.c",
+    musl_lib_dir_relative_path ++ "src/select/poll.c",
+    musl_lib_dir_relative_path ++ "src/select/pselect.c",
+    musl_lib_dir_relative_path ++ "src/select/select.c",
+    musl_lib_dir_relative_path ++ "src/setjmp/longjmp.c",
+    musl_lib_dir_relative_path ++ "src/setjmp/setjmp.c",
+    musl_lib_dir_relative_path ++ "src/signal/block.c",
+    musl_lib_dir_relative_path ++ "src/signal/getitimer.c",
+    musl_lib_dir_relative_path ++ "src/signal/kill.c",
+    musl_lib_dir_relative_path ++ "src/signal/killpg.c",
+    musl_lib_dir_relative_path ++ "src/signal/psiginfo.c",
+    musl_lib_dir_relative_path ++ "src/signal/psignal.c",
+    musl_lib_dir_relative_path ++ "src/signal/raise.c",
+    musl_lib_dir_relative_path ++ "src/signal/restore.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigaction.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigaddset.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigaltstack.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigandset.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigdelset.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigemptyset.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigfillset.c",
+    musl_lib_dir_relative_path ++ "src/signal/sighold.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigignore.c",
+    musl_lib_dir_relative_path ++ "src/signal/siginterrupt.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigisemptyset.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigismember.c",
+    musl_lib_dir_relative_path ++ "src/signal/siglongjmp.c",
+    musl_lib_dir_relative_path ++ "src/signal/signal.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigorset.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigpause.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigpending.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigprocmask.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigqueue.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigrelse.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigrtmax.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigrtmin.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigset.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigsetjmp.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigsetjmp_tail.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigsuspend.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigtimedwait.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigwait.c",
+    musl_lib_dir_relative_path ++ "src/signal/sigwaitinfo.c",
+    musl_lib_dir_relative_path ++ "src/stat/__xstat.c",
+    musl_lib_dir_relative_path ++ "src/stat/chmod.c",
+    musl_lib_dir_relative_path ++ "src/stat/fchmod.c",
+    musl_lib_dir_relative_path ++ "src/stat/fchmodat.c",
+    musl_lib_dir_relative_path ++ "src/stat/fstat.c",
+    musl_lib_dir_relative_path ++ "src/stat/fstatat.c",
+    musl_lib_dir_relative_path ++ "src/stat/futimens.c",
+    musl_lib_dir_relative_path ++ "src/stat/futimesat.c",
+    musl_lib_dir_relative_path ++ "src/stat/lchmod.c",
+    musl_lib_dir_relative_path ++ "src/stat/lstat.c",
+    musl_lib_dir_relative_path ++ "src/stat/mkdir.c",
+    musl_lib_dir_relative_path ++ "src/stat/mkdirat.c",
+    musl_lib_dir_relative_path ++ "src/stat/mkfifo.c",
+    musl_lib_dir_relative_path ++ "src/stat/mkfifoat.c",
+    musl_lib_dir_relative_path ++ "src/stat/mknod.c",
+    musl_lib_dir_relative_path ++ "src/stat/mknodat.c",
+    musl_lib_dir_relative_path ++ "src/stat/stat.c",
+    musl_lib_dir_relative_path ++ "src/stat/statvfs.c",
+    musl_lib_dir_relative_path ++ "src/stat/umask.c",
+    musl_lib_dir_relative_path ++ "src/stat/utimensat.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__fclose_ca.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__fdopen.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__fmodeflags.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__fopen_rb_ca.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__lockfile.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__overflow.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__stdio_close.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__stdio_exit.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__stdio_read.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__stdio_seek.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__stdio_write.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__stdout_write.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__toread.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__towrite.c",
+    musl_lib_dir_relative_path ++ "src/stdio/__uflow.c",
+    musl_lib_dir_relative_path ++ "src/stdio/asprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/clearerr.c",
+    musl_lib_dir_relative_path ++ "src/stdio/dprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/ext.c",
+    musl_lib_dir_relative_path ++ "src/stdio/ext2.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fclose.c",
+    musl_lib_dir_relative_path ++ "src/stdio/feof.c",
+    musl_lib_dir_relative_path ++ "src/stdio/ferror.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fflush.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fgetc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fgetln.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fgetpos.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fgets.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fgetwc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fgetws.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fileno.c",
+    musl_lib_dir_relative_path ++ "src/stdio/flockfile.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fmemopen.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fopen.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fopencookie.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fputc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fputs.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fputwc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fputws.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fread.c",
+    musl_lib_dir_relative_path ++ "src/stdio/freopen.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fseek.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fsetpos.c",
+    musl_lib_dir_relative_path ++ "src/stdio/ftell.c",
+    musl_lib_dir_relative_path ++ "src/stdio/ftrylockfile.c",
+    musl_lib_dir_relative_path ++ "src/stdio/funlockfile.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fwide.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fwprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fwrite.c",
+    musl_lib_dir_relative_path ++ "src/stdio/fwscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/getc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/getc_unlocked.c",
+    musl_lib_dir_relative_path ++ "src/stdio/getchar.c",
+    musl_lib_dir_relative_path ++ "src/stdio/getchar_unlocked.c",
+    musl_lib_dir_relative_path ++ "src/stdio/getdelim.c",
+    musl_lib_dir_relative_path ++ "src/stdio/getline.c",
+    musl_lib_dir_relative_path ++ "src/stdio/gets.c",
+    musl_lib_dir_relative_path ++ "src/stdio/getw.c",
+    musl_lib_dir_relative_path ++ "src/stdio/getwc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/getwchar.c",
+    musl_lib_dir_relative_path ++ "src/stdio/ofl.c",
+    musl_lib_dir_relative_path ++ "src/stdio/ofl_add.c",
+    musl_lib_dir_relative_path ++ "src/stdio/open_memstream.c",
+    musl_lib_dir_relative_path ++ "src/stdio/open_wmemstream.c",
+    musl_lib_dir_relative_path ++ "src/stdio/pclose.c",
+    musl_lib_dir_relative_path ++ "src/stdio/perror.c",
+    musl_lib_dir_relative_path ++ "src/stdio/popen.c",
+    musl_lib_dir_relative_path ++ "src/stdio/printf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/putc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/putc_unlocked.c",
+    musl_lib_dir_relative_path ++ "src/stdio/putchar.c",
+    musl_lib_dir_relative_path ++ "src/stdio/putchar_unlocked.c",
+    musl_lib_dir_relative_path ++ "src/stdio/puts.c",
+    musl_lib_dir_relative_path ++ "src/stdio/putw.c",
+    musl_lib_dir_relative_path ++ "src/stdio/putwc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/putwchar.c",
+    musl_lib_dir_relative_path ++ "src/stdio/remove.c",
+    musl_lib_dir_relative_path ++ "src/stdio/rename.c",
+    musl_lib_dir_relative_path ++ "src/stdio/rewind.c",
+    musl_lib_dir_relative_path ++ "src/stdio/scanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/setbuf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/setbuffer.c",
+    musl_lib_dir_relative_path ++ "src/stdio/setlinebuf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/setvbuf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/snprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/sprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/sscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/stderr.c",
+    musl_lib_dir_relative_path ++ "src/stdio/stdin.c",
+    musl_lib_dir_relative_path ++ "src/stdio/stdout.c",
+    musl_lib_dir_relative_path ++ "src/stdio/swprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/swscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/tempnam.c",
+    musl_lib_dir_relative_path ++ "src/stdio/tmpfile.c",
+    musl_lib_dir_relative_path ++ "src/stdio/tmpnam.c",
+    musl_lib_dir_relative_path ++ "src/stdio/ungetc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/ungetwc.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vasprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vdprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vfprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vfscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vfwprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vfwscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vsnprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vsprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vsscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vswprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vswscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vwprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/vwscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/wprintf.c",
+    musl_lib_dir_relative_path ++ "src/stdio/wscanf.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/abs.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/atof.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/atoi.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/atol.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/atoll.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/bsearch.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/div.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/ecvt.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/fcvt.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/gcvt.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/imaxabs.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/imaxdiv.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/labs.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/ldiv.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/llabs.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/lldiv.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/qsort.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/qsort_nr.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/strtod.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/strtol.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/wcstod.c",
+    musl_lib_dir_relative_path ++ "src/stdlib/wcstol.c",
+    musl_lib_dir_relative_path ++ "src/string/bcmp.c",
+    musl_lib_dir_relative_path ++ "src/string/bcopy.c",
+    musl_lib_dir_relative_path ++ "src/string/bzero.c",
+    musl_lib_dir_relative_path ++ "src/string/explicit_bzero.c",
+    musl_lib_dir_relative_path ++ "src/string/index.c",
+    musl_lib_dir_relative_path ++ "src/string/memccpy.c",
+    musl_lib_dir_relative_path ++ "src/string/memchr.c",
+    musl_lib_dir_relative_path ++ "src/string/memcmp.c",
+    musl_lib_dir_relative_path ++ "src/string/memcpy.c",
+    musl_lib_dir_relative_path ++ "src/string/memmem.c",
+    musl_lib_dir_relative_path ++ "src/string/memmove.c",
+    musl_lib_dir_relative_path ++ "src/string/mempcpy.c",
+    musl_lib_dir_relative_path ++ "src/string/memrchr.c",
+    musl_lib_dir_relative_path ++ "src/string/memset.c",
+    musl_lib_dir_relative_path ++ "src/string/rindex.c",
+    musl_lib_dir_relative_path ++ "src/string/stpcpy.c",
+    musl_lib_dir_relative_path ++ "src/string/stpncpy.c",
+    musl_lib_dir_relative_path ++ "src/string/strcasecmp.c",
+    musl_lib_dir_relative_path ++ "src/string/strcasestr.c",
+    musl_lib_dir_relative_path ++ "src/string/strcat.c",
+    musl_lib_dir_relative_path ++ "src/string/strchr.c",
+    musl_lib_dir_relative_path ++ "src/string/strchrnul.c",
+    musl_lib_dir_relative_path ++ "src/string/strcmp.c",
+    musl_lib_dir_relative_path ++ "src/string/strcpy.c",
+    musl_lib_dir_relative_path ++ "src/string/strcspn.c",
+    musl_lib_dir_relative_path ++ "src/string/strdup.c",
+    musl_lib_dir_relative_path ++ "src/string/strerror_r.c",
+    musl_lib_dir_relative_path ++ "src/string/strlcat.c",
+    musl_lib_dir_relative_path ++ "src/string/strlcpy.c",
+    musl_lib_dir_relative_path ++ "src/string/strlen.c",
+    musl_lib_dir_relative_path ++ "src/string/strncasecmp.c",
+    musl_lib_dir_relative_path ++ "src/string/strncat.c",
+    musl_lib_dir_relative_path ++ "src/string/strncmp.c",
+    musl_lib_dir_relative_path ++ "src/string/strncpy.c",
+    musl_lib_dir_relative_path ++ "src/string/strndup.c",
+    musl_lib_dir_relative_path ++ "src/string/strnlen.c",
+    musl_lib_dir_relative_path ++ "src/string/strpbrk.c",
+    musl_lib_dir_relative_path ++ "src/string/strrchr.c",
+    musl_lib_dir_relative_path ++ "src/string/strsep.c",
+    musl_lib_dir_relative_path ++ "src/string/strsignal.c",
+    musl_lib_dir_relative_path ++ "src/string/strspn.c",
+    musl_lib_dir_relative_path ++ "src/string/strstr.c",
+    musl_lib_dir_relative_path ++ "src/string/strtok.c",
+    musl_lib_dir_relative_path ++ "src/string/strtok_r.c",
+    musl_lib_dir_relative_path ++ "src/string/strverscmp.c",
+    musl_lib_dir_relative_path ++ "src/string/swab.c",
+    musl_lib_dir_relative_path ++ "src/string/wcpcpy.c",
+    musl_lib_dir_relative_path ++ "src/string/wcpncpy.c",
+    musl_lib_dir_relative_path ++ "src/string/wcscasecmp.c",
+    musl_lib_dir_relative_path ++ "src/string/wcscasecmp_l.c",
+    musl_lib_dir_relative_path ++ "src/string/wcscat.c",
+    musl_lib_dir_relative_path ++ "src/string/wcschr.c",
+    musl_lib_dir_relative_path ++ "src/string/wcscmp.c",
+    musl_lib_dir_relative_path ++ "src/string/wcscpy.c",
+    musl_lib_dir_relative_path ++ "src/string/wcscspn.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsdup.c",
+    musl_lib_dir_relative_path ++ "src/string/wcslen.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsncasecmp.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsncasecmp_l.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsncat.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsncmp.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsncpy.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsnlen.c",
+    musl_lib_dir_relative_path ++ "src/string/wcspbrk.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsrchr.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsspn.c",
+    musl_lib_dir_relative_path ++ "src/string/wcsstr.c",
+    musl_lib_dir_relative_path ++ "src/string/wcstok.c",
+    musl_lib_dir_relative_path ++ "src/string/wcswcs.c",
+    musl_lib_dir_relative_path ++ "src/string/wmemchr.c",
+    musl_lib_dir_relative_path ++ "src/string/wmemcmp.c",
+    musl_lib_dir_relative_path ++ "src/string/wmemcpy.c",
+    musl_lib_dir_relative_path ++ "src/string/wmemmove.c",
+    musl_lib_dir_relative_path ++ "src/string/wmemset.c",
+    musl_lib_dir_relative_path ++ "src/temp/__randname.c",
+    musl_lib_dir_relative_path ++ "src/temp/mkdtemp.c",
+    musl_lib_dir_relative_path ++ "src/temp/mkostemp.c",
+    musl_lib_dir_relative_path ++ "src/temp/mkostemps.c",
+    musl_lib_dir_relative_path ++ "src/temp/mkstemp.c",
+    musl_lib_dir_relative_path ++ "src/temp/mkstemps.c",
+    musl_lib_dir_relative_path ++ "src/temp/mktemp.c",
+    musl_lib_dir_relative_path ++ "src/termios/cfgetospeed.c",
+    musl_lib_dir_relative_path ++ "src/termios/cfmakeraw.c",
+    musl_lib_dir_relative_path ++ "src/termios/cfsetospeed.c",
+    musl_lib_dir_relative_path ++ "src/termios/tcdrain.c",
+    musl_lib_dir_relative_path ++ "src/termios/tcflow.c",
+    musl_lib_dir_relative_path ++ "src/termios/tcflush.c",
+    musl_lib_dir_relative_path ++ "src/termios/tcgetattr.c",
+    musl_lib_dir_relative_path ++ "src/termios/tcgetsid.c",
+    musl_lib_dir_relative_path ++ "src/termios/tcgetwinsize.c",
+    musl_lib_dir_relative_path ++ "src/termios/tcsendbreak.c",
+    musl_lib_dir_relative_path ++ "src/termios/tcsetattr.c",
+    musl_lib_dir_relative_path ++ "src/termios/tcsetwinsize.c",
+    musl_lib_dir_relative_path ++ "src/thread/__lock.c",
+    //musl_lib_dir_relative_path ++ "src/thread/__set_thread_area.c",
+    musl_lib_dir_relative_path ++ "src/thread/__syscall_cp.c",
+    musl_lib_dir_relative_path ++ "src/thread/__timedwait.c",
+    musl_lib_dir_relative_path ++ "src/thread/__tls_get_addr.c",
+    musl_lib_dir_relative_path ++ "src/thread/__unmapself.c",
+    musl_lib_dir_relative_path ++ "src/thread/__wait.c",
+    musl_lib_dir_relative_path ++ "src/thread/call_once.c",
+    musl_lib_dir_relative_path ++ "src/thread/clone.c",
+    musl_lib_dir_relative_path ++ "src/thread/cnd_broadcast.c",
+    musl_lib_dir_relative_path ++ "src/thread/cnd_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/cnd_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/cnd_signal.c",
+    musl_lib_dir_relative_path ++ "src/thread/cnd_timedwait.c",
+    musl_lib_dir_relative_path ++ "src/thread/cnd_wait.c",
+    musl_lib_dir_relative_path ++ "src/thread/default_attr.c",
+    musl_lib_dir_relative_path ++ "src/thread/lock_ptc.c",
+    musl_lib_dir_relative_path ++ "src/thread/mtx_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/mtx_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/mtx_lock.c",
+    musl_lib_dir_relative_path ++ "src/thread/mtx_timedlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/mtx_trylock.c",
+    musl_lib_dir_relative_path ++ "src/thread/mtx_unlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_atfork.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_get.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_setdetachstate.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_setguardsize.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_setinheritsched.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_setschedparam.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_setschedpolicy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_setscope.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_setstack.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_attr_setstacksize.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_barrier_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_barrier_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_barrier_wait.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_barrierattr_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_barrierattr_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_barrierattr_setpshared.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_cancel.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_cleanup_push.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_cond_broadcast.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_cond_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_cond_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_cond_signal.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_cond_timedwait.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_cond_wait.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_condattr_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_condattr_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_condattr_setclock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_condattr_setpshared.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_create.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_detach.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_equal.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_getattr_np.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_getconcurrency.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_getcpuclockid.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_getname_np.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_getschedparam.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_getspecific.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_join.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_key_create.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_kill.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutex_consistent.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutex_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutex_getprioceiling.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutex_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutex_lock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutex_setprioceiling.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutex_timedlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutex_trylock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutex_unlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutexattr_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutexattr_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutexattr_setprotocol.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutexattr_setpshared.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutexattr_setrobust.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_mutexattr_settype.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_once.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlock_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlock_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlock_rdlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlock_timedrdlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlock_timedwrlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlock_tryrdlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlock_trywrlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlock_unlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlock_wrlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlockattr_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlockattr_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_rwlockattr_setpshared.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_self.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_setattr_default_np.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_setcancelstate.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_setcanceltype.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_setconcurrency.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_setname_np.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_setschedparam.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_setschedprio.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_setspecific.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_sigmask.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_spin_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_spin_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_spin_lock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_spin_trylock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_spin_unlock.c",
+    musl_lib_dir_relative_path ++ "src/thread/pthread_testcancel.c",
+    musl_lib_dir_relative_path ++ "src/thread/sem_destroy.c",
+    musl_lib_dir_relative_path ++ "src/thread/sem_getvalue.c",
+    musl_lib_dir_relative_path ++ "src/thread/sem_init.c",
+    musl_lib_dir_relative_path ++ "src/thread/sem_open.c",
+    musl_lib_dir_relative_path ++ "src/thread/sem_post.c",
+    musl_lib_dir_relative_path ++ "src/thread/sem_timedwait.c",
+    musl_lib_dir_relative_path ++ "src/thread/sem_trywait.c",
+    musl_lib_dir_relative_path ++ "src/thread/sem_unlink.c",
+    musl_lib_dir_relative_path ++ "src/thread/sem_wait.c",
+    musl_lib_dir_relative_path ++ "src/thread/synccall.c",
+    musl_lib_dir_relative_path ++ "src/thread/syscall_cp.c",
+    musl_lib_dir_relative_path ++ "src/thread/thrd_create.c",
+    musl_lib_dir_relative_path ++ "src/thread/thrd_exit.c",
+    musl_lib_dir_relative_path ++ "src/thread/thrd_join.c",
+    musl_lib_dir_relative_path ++ "src/thread/thrd_sleep.c",
+    musl_lib_dir_relative_path ++ "src/thread/thrd_yield.c",
+    musl_lib_dir_relative_path ++ "src/thread/tls.c",
+    musl_lib_dir_relative_path ++ "src/thread/tss_create.c",
+    musl_lib_dir_relative_path ++ "src/thread/tss_delete.c",
+    musl_lib_dir_relative_path ++ "src/thread/tss_set.c",
+    musl_lib_dir_relative_path ++ "src/thread/vmlock.c",
+    musl_lib_dir_relative_path ++ "src/time/__map_file.c",
+    musl_lib_dir_relative_path ++ "src/time/__month_to_secs.c",
+    musl_lib_dir_relative_path ++ "src/time/__secs_to_tm.c",
+    musl_lib_dir_relative_path ++ "src/time/__tm_to_secs.c",
+    musl_lib_dir_relative_path ++ "src/time/__tz.c",
+    musl_lib_dir_relative_path ++ "src/time/__year_to_secs.c",
+    musl_lib_dir_relative_path ++ "src/time/asctime.c",
+    musl_lib_dir_relative_path ++ "src/time/asctime_r.c",
+    musl_lib_dir_relative_path ++ "src/time/clock.c",
+    musl_lib_dir_relative_path ++ "src/time/clock_getcpuclockid.c",
+    musl_lib_dir_relative_path ++ "src/time/clock_getres.c",
+    musl_lib_dir_relative_path ++ "src/time/clock_gettime.c",
+    musl_lib_dir_relative_path ++ "src/time/clock_nanosleep.c",
+    musl_lib_dir_relative_path ++ "src/time/clock_settime.c",
+    musl_lib_dir_relative_path ++ "src/time/ctime.c",
+    musl_lib_dir_relative_path ++ "src/time/ctime_r.c",
+    musl_lib_dir_relative_path ++ "src/time/difftime.c",
+    musl_lib_dir_relative_path ++ "src/time/ftime.c",
+    musl_lib_dir_relative_path ++ "src/time/getdate.c",
+    musl_lib_dir_relative_path ++ "src/time/gettimeofday.c",
+    musl_lib_dir_relative_path ++ "src/time/gmtime.c",
+    musl_lib_dir_relative_path ++ "src/time/gmtime_r.c",
+    musl_lib_dir_relative_path ++ "src/time/localtime.c",
+    musl_lib_dir_relative_path ++ "src/time/localtime_r.c",
+    musl_lib_dir_relative_path ++ "src/time/mktime.c",
+    musl_lib_dir_relative_path ++ "src/time/nanosleep.c",
+    musl_lib_dir_relative_path ++ "src/time/strftime.c",
+    musl_lib_dir_relative_path ++ "src/time/strptime.c",
+    musl_lib_dir_relative_path ++ "src/time/time.c",
+    musl_lib_dir_relative_path ++ "src/time/timegm.c",
+    musl_lib_dir_relative_path ++ "src/time/timer_create.c",
+    musl_lib_dir_relative_path ++ "src/time/timer_delete.c",
+    musl_lib_dir_relative_path ++ "src/time/timer_getoverrun.c",
+    musl_lib_dir_relative_path ++ "src/time/timer_gettime.c",
+    musl_lib_dir_relative_path ++ "src/time/timer_settime.c",
+    musl_lib_dir_relative_path ++ "src/time/times.c",
+    musl_lib_dir_relative_path ++ "src/time/timespec_get.c",
+    musl_lib_dir_relative_path ++ "src/time/utime.c",
+    musl_lib_dir_relative_path ++ "src/time/wcsftime.c",
+    musl_lib_dir_relative_path ++ "src/unistd/_exit.c",
+    musl_lib_dir_relative_path ++ "src/unistd/access.c",
+    musl_lib_dir_relative_path ++ "src/unistd/acct.c",
+    musl_lib_dir_relative_path ++ "src/unistd/alarm.c",
+    musl_lib_dir_relative_path ++ "src/unistd/chdir.c",
+    musl_lib_dir_relative_path ++ "src/unistd/chown.c",
+    musl_lib_dir_relative_path ++ "src/unistd/close.c",
+    musl_lib_dir_relative_path ++ "src/unistd/ctermid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/dup.c",
+    musl_lib_dir_relative_path ++ "src/unistd/dup2.c",
+    musl_lib_dir_relative_path ++ "src/unistd/dup3.c",
+    musl_lib_dir_relative_path ++ "src/unistd/faccessat.c",
+    musl_lib_dir_relative_path ++ "src/unistd/fchdir.c",
+    musl_lib_dir_relative_path ++ "src/unistd/fchown.c",
+    musl_lib_dir_relative_path ++ "src/unistd/fchownat.c",
+    musl_lib_dir_relative_path ++ "src/unistd/fdatasync.c",
+    musl_lib_dir_relative_path ++ "src/unistd/fsync.c",
+    musl_lib_dir_relative_path ++ "src/unistd/ftruncate.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getcwd.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getegid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/geteuid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getgid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getgroups.c",
+    musl_lib_dir_relative_path ++ "src/unistd/gethostname.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getlogin.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getlogin_r.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getpgid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getpgrp.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getpid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getppid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getsid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/getuid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/isatty.c",
+    musl_lib_dir_relative_path ++ "src/unistd/lchown.c",
+    musl_lib_dir_relative_path ++ "src/unistd/link.c",
+    musl_lib_dir_relative_path ++ "src/unistd/linkat.c",
+    musl_lib_dir_relative_path ++ "src/unistd/lseek.c",
+    musl_lib_dir_relative_path ++ "src/unistd/nice.c",
+    musl_lib_dir_relative_path ++ "src/unistd/pause.c",
+    musl_lib_dir_relative_path ++ "src/unistd/pipe.c",
+    musl_lib_dir_relative_path ++ "src/unistd/pipe2.c",
+    musl_lib_dir_relative_path ++ "src/unistd/posix_close.c",
+    musl_lib_dir_relative_path ++ "src/unistd/pread.c",
+    musl_lib_dir_relative_path ++ "src/unistd/preadv.c",
+    musl_lib_dir_relative_path ++ "src/unistd/pwrite.c",
+    musl_lib_dir_relative_path ++ "src/unistd/pwritev.c",
+    musl_lib_dir_relative_path ++ "src/unistd/read.c",
+    musl_lib_dir_relative_path ++ "src/unistd/readlink.c",
+    musl_lib_dir_relative_path ++ "src/unistd/readlinkat.c",
+    musl_lib_dir_relative_path ++ "src/unistd/readv.c",
+    musl_lib_dir_relative_path ++ "src/unistd/renameat.c",
+    musl_lib_dir_relative_path ++ "src/unistd/rmdir.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setegid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/seteuid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setgid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setpgid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setpgrp.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setregid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setresgid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setresuid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setreuid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setsid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setuid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/setxid.c",
+    musl_lib_dir_relative_path ++ "src/unistd/sleep.c",
+    musl_lib_dir_relative_path ++ "src/unistd/symlink.c",
+    musl_lib_dir_relative_path ++ "src/unistd/symlinkat.c",
+    musl_lib_dir_relative_path ++ "src/unistd/sync.c",
+    musl_lib_dir_relative_path ++ "src/unistd/tcgetpgrp.c",
+    musl_lib_dir_relative_path ++ "src/unistd/tcsetpgrp.c",
+    musl_lib_dir_relative_path ++ "src/unistd/truncate.c",
+    musl_lib_dir_relative_path ++ "src/unistd/ttyname.c",
+    musl_lib_dir_relative_path ++ "src/unistd/ttyname_r.c",
+    musl_lib_dir_relative_path ++ "src/unistd/ualarm.c",
+    musl_lib_dir_relative_path ++ "src/unistd/unlink.c",
+    musl_lib_dir_relative_path ++ "src/unistd/unlinkat.c",
+    musl_lib_dir_relative_path ++ "src/unistd/usleep.c",
+    musl_lib_dir_relative_path ++ "src/unistd/write.c",
+    musl_lib_dir_relative_path ++ "src/unistd/writev.c",
+};
+
+const musl_x86_64_source_files = [_][]const u8{
+    musl_lib_dir_relative_path ++ "src/fenv/x86_64/fenv.s",
+    musl_lib_dir_relative_path ++ "src/ldso/x86_64/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/x86_64/tlsdesc.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/__invtrigl.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/acosl.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/asinl.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/atan2l.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/atanl.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/ceill.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/exp2l.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/expl.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/expm1l.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/fabsl.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/floorl.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/fma.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/fmaf.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/fmodl.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/llrint.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/llrintf.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/llrintl.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/log10l.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/log1pl.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/log2l.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/logl.s",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/lrint.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/lrintf.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/lrintl.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/remainderl.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/remquol.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/rintl.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/sqrtl.c",
+    musl_lib_dir_relative_path ++ "src/math/x86_64/truncl.s",
+    musl_lib_dir_relative_path ++ "src/process/x86_64/vfork.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/x86_64/longjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/x86_64/setjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/x86_64/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/x86_64/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/string/x86_64/memcpy.s",
+    musl_lib_dir_relative_path ++ "src/string/x86_64/memmove.s",
+    musl_lib_dir_relative_path ++ "src/string/x86_64/memset.s",
+    musl_lib_dir_relative_path ++ "src/thread/x86_64/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/x86_64/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/x86_64/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/x86_64/syscall_cp.s",
+};
+
+const musl_arch_files = [_][]const u8{
+    musl_lib_dir_relative_path ++ "src/fenv/aarch64/fenv.s",
+    musl_lib_dir_relative_path ++ "src/fenv/arm/fenv-hf.S",
+    musl_lib_dir_relative_path ++ "src/fenv/arm/fenv.c",
+    musl_lib_dir_relative_path ++ "src/fenv/i386/fenv.s",
+    musl_lib_dir_relative_path ++ "src/fenv/m68k/fenv.c",
+    musl_lib_dir_relative_path ++ "src/fenv/mips/fenv-sf.c",
+    musl_lib_dir_relative_path ++ "src/fenv/mips/fenv.S",
+    musl_lib_dir_relative_path ++ "src/fenv/mips64/fenv-sf.c",
+    musl_lib_dir_relative_path ++ "src/fenv/mips64/fenv.S",
+    musl_lib_dir_relative_path ++ "src/fenv/mipsn32/fenv-sf.c",
+    musl_lib_dir_relative_path ++ "src/fenv/mipsn32/fenv.S",
+    musl_lib_dir_relative_path ++ "src/fenv/powerpc/fenv-sf.c",
+    musl_lib_dir_relative_path ++ "src/fenv/powerpc/fenv.S",
+    musl_lib_dir_relative_path ++ "src/fenv/powerpc64/fenv.c",
+    musl_lib_dir_relative_path ++ "src/fenv/riscv64/fenv-sf.c",
+    musl_lib_dir_relative_path ++ "src/fenv/riscv64/fenv.S",
+    musl_lib_dir_relative_path ++ "src/fenv/s390x/fenv.c",
+    musl_lib_dir_relative_path ++ "src/fenv/sh/fenv-nofpu.c",
+    musl_lib_dir_relative_path ++ "src/fenv/sh/fenv.S",
+    musl_lib_dir_relative_path ++ "src/fenv/x32/fenv.s",
+    musl_lib_dir_relative_path ++ "src/internal/i386/defsysinfo.s",
+    musl_lib_dir_relative_path ++ "src/internal/sh/__shcall.c",
+    musl_lib_dir_relative_path ++ "src/ldso/aarch64/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/aarch64/tlsdesc.s",
+    musl_lib_dir_relative_path ++ "src/ldso/arm/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/arm/dlsym_time64.S",
+    musl_lib_dir_relative_path ++ "src/ldso/arm/find_exidx.c",
+    musl_lib_dir_relative_path ++ "src/ldso/arm/tlsdesc.S",
+    musl_lib_dir_relative_path ++ "src/ldso/i386/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/i386/dlsym_time64.S",
+    musl_lib_dir_relative_path ++ "src/ldso/i386/tlsdesc.s",
+    musl_lib_dir_relative_path ++ "src/ldso/m68k/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/m68k/dlsym_time64.S",
+    musl_lib_dir_relative_path ++ "src/ldso/microblaze/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/microblaze/dlsym_time64.S",
+    musl_lib_dir_relative_path ++ "src/ldso/mips/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/mips/dlsym_time64.S",
+    musl_lib_dir_relative_path ++ "src/ldso/mips64/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/mipsn32/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/mipsn32/dlsym_time64.S",
+    musl_lib_dir_relative_path ++ "src/ldso/or1k/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/or1k/dlsym_time64.S",
+    musl_lib_dir_relative_path ++ "src/ldso/powerpc/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/powerpc/dlsym_time64.S",
+    musl_lib_dir_relative_path ++ "src/ldso/powerpc64/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/riscv64/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/s390x/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/sh/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/ldso/sh/dlsym_time64.S",
+    musl_lib_dir_relative_path ++ "src/ldso/tlsdesc.c",
+    musl_lib_dir_relative_path ++ "src/ldso/x32/dlsym.s",
+    musl_lib_dir_relative_path ++ "src/linux/x32/sysinfo.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/ceil.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/ceilf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/floor.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/floorf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/fma.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/fmaf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/fmax.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/fmaxf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/fmin.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/fminf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/llrint.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/llrintf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/llround.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/llroundf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/lrint.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/lrintf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/lround.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/lroundf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/nearbyint.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/nearbyintf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/rint.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/rintf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/round.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/roundf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/trunc.c",
+    musl_lib_dir_relative_path ++ "src/math/aarch64/truncf.c",
+    musl_lib_dir_relative_path ++ "src/math/arm/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/arm/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/arm/fma.c",
+    musl_lib_dir_relative_path ++ "src/math/arm/fmaf.c",
+    musl_lib_dir_relative_path ++ "src/math/arm/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/arm/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/__invtrigl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/acos.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/acosf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/acosl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/asin.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/asinf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/asinl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/atan.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/atan2.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/atan2f.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/atan2l.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/atanf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/atanl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/ceil.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/ceilf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/ceill.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/exp2l.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/exp_ld.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/expl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/expm1l.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/fabsl.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/floor.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/floorf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/floorl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/fmod.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/fmodf.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/fmodl.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/hypot.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/hypotf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/ldexp.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/ldexpf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/ldexpl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/llrint.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/llrintf.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/llrintl.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/log.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/log10.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/log10f.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/log10l.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/log1p.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/log1pf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/log1pl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/log2.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/log2f.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/log2l.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/logf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/logl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/lrint.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/lrintf.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/lrintl.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/remainder.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/remainderf.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/remainderl.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/remquo.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/remquof.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/remquol.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/rint.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/rintf.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/rintl.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/scalbln.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/scalblnf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/scalblnl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/scalbn.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/scalbnf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/scalbnl.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/sqrtl.c",
+    musl_lib_dir_relative_path ++ "src/math/i386/trunc.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/truncf.s",
+    musl_lib_dir_relative_path ++ "src/math/i386/truncl.s",
+    musl_lib_dir_relative_path ++ "src/math/m68k/sqrtl.c",
+    musl_lib_dir_relative_path ++ "src/math/mips/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/mips/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/mips/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/mips/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc/fma.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc/fmaf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/ceil.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/ceilf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/floor.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/floorf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/fma.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/fmaf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/fmax.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/fmaxf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/fmin.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/fminf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/lrint.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/lrintf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/lround.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/lroundf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/round.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/roundf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/trunc.c",
+    musl_lib_dir_relative_path ++ "src/math/powerpc64/truncf.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/copysign.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/copysignf.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/fma.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/fmaf.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/fmax.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/fmaxf.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/fmin.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/fminf.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/riscv64/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/ceil.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/ceilf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/ceill.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/fabs.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/fabsf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/fabsl.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/floor.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/floorf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/floorl.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/fma.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/fmaf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/nearbyint.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/nearbyintf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/nearbyintl.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/rint.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/rintf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/rintl.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/round.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/roundf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/roundl.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/sqrt.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/sqrtf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/sqrtl.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/trunc.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/truncf.c",
+    musl_lib_dir_relative_path ++ "src/math/s390x/truncl.c",
+    musl_lib_dir_relative_path ++ "src/math/x32/__invtrigl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/acosl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/asinl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/atan2l.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/atanl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/ceill.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/exp2l.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/expl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/expm1l.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/fabs.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/fabsf.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/fabsl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/floorl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/fma.c",
+    musl_lib_dir_relative_path ++ "src/math/x32/fmaf.c",
+    musl_lib_dir_relative_path ++ "src/math/x32/fmodl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/llrint.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/llrintf.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/llrintl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/log10l.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/log1pl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/log2l.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/logl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/lrint.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/lrintf.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/lrintl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/remainderl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/rintl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/sqrt.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/sqrtf.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/sqrtl.s",
+    musl_lib_dir_relative_path ++ "src/math/x32/truncl.s",
+    musl_lib_dir_relative_path ++ "src/process/aarch64/vfork.s",
+    musl_lib_dir_relative_path ++ "src/process/arm/vfork.s",
+    musl_lib_dir_relative_path ++ "src/process/i386/vfork.s",
+    musl_lib_dir_relative_path ++ "src/process/riscv64/vfork.s",
+    musl_lib_dir_relative_path ++ "src/process/s390x/vfork.s",
+    musl_lib_dir_relative_path ++ "src/process/sh/vfork.s",
+    musl_lib_dir_relative_path ++ "src/process/system.c",
+    musl_lib_dir_relative_path ++ "src/process/vfork.c",
+    musl_lib_dir_relative_path ++ "src/process/wait.c",
+    musl_lib_dir_relative_path ++ "src/process/waitid.c",
+    musl_lib_dir_relative_path ++ "src/process/waitpid.c",
+    musl_lib_dir_relative_path ++ "src/process/x32/vfork.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/aarch64/longjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/aarch64/setjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/arm/longjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/arm/setjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/i386/longjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/i386/setjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/m68k/longjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/m68k/setjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/microblaze/longjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/microblaze/setjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/mips/longjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/mips/setjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/mips64/longjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/mips64/setjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/mipsn32/longjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/mipsn32/setjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/or1k/longjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/or1k/setjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/powerpc/longjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/powerpc/setjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/powerpc64/longjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/powerpc64/setjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/riscv64/longjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/riscv64/setjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/s390x/longjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/s390x/setjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/sh/longjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/sh/setjmp.S",
+    musl_lib_dir_relative_path ++ "src/setjmp/x32/longjmp.s",
+    musl_lib_dir_relative_path ++ "src/setjmp/x32/setjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/aarch64/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/aarch64/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/arm/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/arm/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/i386/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/i386/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/m68k/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/microblaze/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/microblaze/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/mips/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/mips64/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/mipsn32/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/or1k/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/powerpc/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/powerpc/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/powerpc64/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/powerpc64/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/riscv64/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/riscv64/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/s390x/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/s390x/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/setitimer.c",
+    musl_lib_dir_relative_path ++ "src/signal/sh/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/sh/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/signal/x32/getitimer.c",
+    musl_lib_dir_relative_path ++ "src/signal/x32/restore.s",
+    musl_lib_dir_relative_path ++ "src/signal/x32/setitimer.c",
+    musl_lib_dir_relative_path ++ "src/signal/x32/sigsetjmp.s",
+    musl_lib_dir_relative_path ++ "src/string/aarch64/memcpy.S",
+    musl_lib_dir_relative_path ++ "src/string/aarch64/memset.S",
+    musl_lib_dir_relative_path ++ "src/string/arm/__aeabi_memcpy.s",
+    musl_lib_dir_relative_path ++ "src/string/arm/__aeabi_memset.s",
+    musl_lib_dir_relative_path ++ "src/string/arm/memcpy.S",
+    musl_lib_dir_relative_path ++ "src/string/i386/memcpy.s",
+    musl_lib_dir_relative_path ++ "src/string/i386/memmove.s",
+    musl_lib_dir_relative_path ++ "src/string/i386/memset.s",
+    musl_lib_dir_relative_path ++ "src/thread/aarch64/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/aarch64/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/aarch64/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/aarch64/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/arm/__aeabi_read_tp.s",
+    musl_lib_dir_relative_path ++ "src/thread/arm/__set_thread_area.c",
+    musl_lib_dir_relative_path ++ "src/thread/arm/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/arm/atomics.s",
+    musl_lib_dir_relative_path ++ "src/thread/arm/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/arm/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/i386/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/i386/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/i386/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/i386/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/i386/tls.s",
+    musl_lib_dir_relative_path ++ "src/thread/m68k/__m68k_read_tp.s",
+    musl_lib_dir_relative_path ++ "src/thread/m68k/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/m68k/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/microblaze/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/microblaze/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/microblaze/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/microblaze/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/mips/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/mips/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/mips/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/mips64/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/mips64/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/mips64/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/mipsn32/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/mipsn32/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/mipsn32/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/or1k/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/or1k/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/or1k/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/or1k/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/powerpc/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/powerpc/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/powerpc/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/powerpc/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/powerpc64/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/powerpc64/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/powerpc64/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/powerpc64/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/riscv64/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/riscv64/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/riscv64/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/riscv64/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/s390x/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/s390x/__tls_get_offset.s",
+    musl_lib_dir_relative_path ++ "src/thread/s390x/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/s390x/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/s390x/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/sh/__set_thread_area.c",
+    musl_lib_dir_relative_path ++ "src/thread/sh/__unmapself.c",
+    musl_lib_dir_relative_path ++ "src/thread/sh/__unmapself_mmu.s",
+    musl_lib_dir_relative_path ++ "src/thread/sh/atomics.s",
+    musl_lib_dir_relative_path ++ "src/thread/sh/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/sh/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/thread/x32/__set_thread_area.s",
+    musl_lib_dir_relative_path ++ "src/thread/x32/__unmapself.s",
+    musl_lib_dir_relative_path ++ "src/thread/x32/clone.s",
+    musl_lib_dir_relative_path ++ "src/thread/x32/syscall_cp.s",
+    musl_lib_dir_relative_path ++ "src/unistd/mips/pipe.s",
+    musl_lib_dir_relative_path ++ "src/unistd/mips64/pipe.s",
+    musl_lib_dir_relative_path ++ "src/unistd/mipsn32/lseek.c",
+    musl_lib_dir_relative_path ++ "src/unistd/mipsn32/pipe.s",
+    musl_lib_dir_relative_path ++ "src/unistd/sh/pipe.s",
+    musl_lib_dir_relative_path ++ "src/unistd/x32/lseek.c",
+};
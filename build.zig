@@ -93,9 +93,10 @@ pub fn build(b: *std.Build) !void {
         "src/llvm/llvm.cpp",
         "src/llvm/lld.cpp",
         "src/llvm/clang_main.cpp",
+        "src/llvm/clang_batch.cpp",
         "src/llvm/clang_cc1.cpp",
         "src/llvm/clang_cc1as.cpp",
-        // "src/llvm/ar.cpp",
+        "src/llvm/ar.cpp",
     };
 
     compiler.addCSourceFiles(.{
@@ -626,9 +627,34 @@ pub fn build(b: *std.Build) !void {
 
     const test_command = b.addRunArtifact(test_runner);
     test_command.step.dependOn(&compiler.step);
+    // Member of the archives `nat ar` writes in the ARCHIVE test group
+    const archive_member = b.addObject(.{
+        .name = "archive_member",
+        .target = native_target,
+        .optimize = .ReleaseSmall,
+    });
+    archive_member.addCSourceFile(.{
+        .file = b.path("retest/archive/member.c"),
+        .flags = &.{},
+    });
+    test_command.addArg("-archive_member");
+    test_command.addFileArg(archive_member.getEmittedBin());
     b.installArtifact(test_runner);
     test_command.step.dependOn(b.getInstallStep());
 
+    // `nat musl` needs the musl sources, which are not part of the repository, so this at least keeps the musl build compiling
+    const musl_test = b.addTest(.{
+        .name = "musl_test",
+        .root_source_file = b.path("bootstrap/musl.zig"),
+        .target = native_target,
+        .optimize = optimization,
+    });
+    const musl_test_command = b.addRunArtifact(musl_test);
+
+    const stress_command = b.addRunArtifact(test_runner);
+    stress_command.addArg("stress");
+    stress_command.step.dependOn(b.getInstallStep());
+
     const new_test = b.addExecutable(.{
         .name = "new_test",
         .target = native_target,
@@ -640,11 +666,34 @@ pub fn build(b: *std.Build) !void {
     const new_test_command = b.addRunArtifact(new_test);
     new_test_command.step.dependOn(b.getInstallStep());
 
+    const client = b.addExecutable(.{
+        .name = "nat_client",
+        .root_source_file = b.path("build/client.zig"),
+        .target = native_target,
+        .optimize = .ReleaseFast,
+    });
+    b.installArtifact(client);
+
+    const benchmark = b.addExecutable(.{
+        .name = "benchmark",
+        .root_source_file = b.path("build/benchmark.zig"),
+        .target = native_target,
+        .optimize = .ReleaseFast,
+    });
+    benchmark.root_module.addAnonymousImport("library", .{
+        .root_source_file = b.path("bootstrap/library.zig"),
+    });
+    b.default_step.dependOn(&benchmark.step);
+
+    const benchmark_command = b.addRunArtifact(benchmark);
+    benchmark_command.step.dependOn(b.getInstallStep());
+
     if (b.args) |args| {
         run_command.addArgs(args);
         debug_command.addArgs(args);
         test_command.addArgs(args);
         new_test_command.addArgs(args);
+        benchmark_command.addArgs(args);
     }
 
     const run_step = b.step("run", "Test the Nativity compiler");
@@ -653,11 +702,19 @@ pub fn build(b: *std.Build) !void {
     debug_step.dependOn(&debug_command.step);
     const test_step = b.step("test", "Test the Nativity compiler");
     test_step.dependOn(&test_command.step);
+    test_step.dependOn(&musl_test_command.step);
     const new_test_step = b.step("new_test", "Script to make a new test");
     new_test_step.dependOn(&new_test_command.step);
+    const benchmark_step = b.step("benchmark", "Benchmark the Nativity compiler");
+    benchmark_step.dependOn(&benchmark_command.step);
+
+    const stress_step = b.step("stress", "Stress test the Nativity compiler with a very large generated program");
+    stress_step.dependOn(&stress_command.step);
 
     const test_all = b.step("test_all", "Test all");
     test_all.dependOn(&test_command.step);
+    test_all.dependOn(&musl_test_command.step);
+    test_all.dependOn(&stress_command.step);
 }
 
 
@@ -0,0 +1,418 @@
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+const library = @import("library");
+
+const bootstrap_relative_path = "zig-out/bin/nat";
+const standalone_directory_path = "retest/standalone";
+
+fn collectDirectoryDirEntries(allocator: Allocator, path: []const u8) ![]const []const u8 {
+    var dir = try std.fs.cwd().openDir(path, .{
+        .iterate = true,
+    });
+    var dir_iterator = dir.iterate();
+    var dir_entries = std.ArrayListUnmanaged([]const u8){};
+
+    while (try dir_iterator.next()) |entry| {
+        switch (entry.kind) {
+            .directory => try dir_entries.append(allocator, try allocator.dupe(u8, entry.name)),
+            else => {},
+        }
+    }
+
+    dir.close();
+
+    return dir_entries.items;
+}
+
+const Sample = struct{
+    wall_ns: u64 = 0,
+    cpu_ns: u64 = 0,
+    runs: usize = 0,
+    failures: usize = 0,
+
+    fn add(sample: *Sample, other: Sample) void {
+        sample.wall_ns += other.wall_ns;
+        sample.cpu_ns += other.cpu_ns;
+        sample.runs += other.runs;
+        sample.failures += other.failures;
+    }
+
+    fn print(sample: Sample, name: []const u8) void {
+        const wall_ms = @as(f64, @floatFromInt(sample.wall_ns)) / 1000_000.0;
+        const cpu_ms = @as(f64, @floatFromInt(sample.cpu_ns)) / 1000_000.0;
+        const run_count = @as(f64, @floatFromInt(@max(sample.runs, 1)));
+        std.debug.print("{s}: {} runs ({} failed). Wall: {d:.02} ms ({d:.02} ms/run). CPU: {d:.02} ms ({d:.02} ms/run). CPU/wall: {d:.02}\n", .{
+            name,
+            sample.runs,
+            sample.failures,
+            wall_ms,
+            wall_ms / run_count,
+            cpu_ms,
+            cpu_ms / run_count,
+            cpu_ms / @max(wall_ms, 0.001),
+        });
+    }
+};
+
+fn children_cpu_ns() u64 {
+    const usage = std.posix.getrusage(std.posix.rusage.CHILDREN);
+    const user_ns = @as(u64, @intCast(usage.utime.tv_sec)) * std.time.ns_per_s + @as(u64, @intCast(usage.utime.tv_usec)) * std.time.ns_per_us;
+    const system_ns = @as(u64, @intCast(usage.stime.tv_sec)) * std.time.ns_per_s + @as(u64, @intCast(usage.stime.tv_usec)) * std.time.ns_per_us;
+    return user_ns + system_ns;
+}
+
+// Wall and CPU time of a single child process. CPU time is read from the accumulated usage of waited-for children
+fn measure_run(allocator: Allocator, argv: []const []const u8) !Sample {
+    const cpu_start = children_cpu_ns();
+    const wall_start = try std.time.Instant.now();
+    const result = try std.process.Child.run(.{
+        .allocator = allocator,
+        .argv = argv,
+        .max_output_bytes = std.math.maxInt(u64),
+    });
+    const wall_end = try std.time.Instant.now();
+    const cpu_end = children_cpu_ns();
+
+    const success = switch (result.term) {
+        .Exited => |exit_code| exit_code == 0,
+        else => false,
+    };
+
+    if (!success and result.stderr.len > 0) {
+        std.debug.print("STDERR:\n\n{s}\n\n", .{result.stderr});
+    }
+
+    return .{
+        .wall_ns = wall_end.since(wall_start),
+        .cpu_ns = cpu_end - cpu_start,
+        .runs = 1,
+        .failures = @intFromBool(!success),
+    };
+}
+
+fn benchmark_thread_wait(allocator: Allocator, repetitions: usize) !void {
+    const test_names = try collectDirectoryDirEntries(allocator, standalone_directory_path);
+    const modes = [_][]const u8{ "spin", "park" };
+    var samples = [1]Sample{.{}} ** modes.len;
+
+    std.debug.print("\n[THREAD WAIT BENCHMARK ({} tests, {} repetitions)]\n\n", .{test_names.len, repetitions});
+
+    // Interleave the modes so that frequency scaling and caches affect both alike
+    for (0..repetitions) |_| {
+        for (test_names) |test_name| {
+            const source_file_path = try std.mem.concat(allocator, u8, &.{ standalone_directory_path, "/", test_name, "/main.nat" });
+
+            for (modes, &samples) |mode, *sample| {
+                const run = try measure_run(allocator, &.{ bootstrap_relative_path, "exe", "-thread_wait", mode, "-main_source_file", source_file_path });
+                sample.add(run);
+            }
+        }
+    }
+
+    for (modes, samples) |mode, sample| {
+        sample.print(mode);
+    }
+
+    for (samples) |sample| {
+        if (sample.failures > 0) return error.fail;
+    }
+}
+
+fn collect_source_files(allocator: Allocator, directory_path: []const u8) ![]const []const u8 {
+    var dir = try std.fs.cwd().openDir(directory_path, .{
+        .iterate = true,
+    });
+    defer dir.close();
+
+    var walker = try dir.walk(allocator);
+    defer walker.deinit();
+
+    var sources = std.ArrayListUnmanaged([]const u8){};
+    while (try walker.next()) |entry| {
+        if (entry.kind == .file and std.mem.endsWith(u8, entry.basename, ".nat")) {
+            try sources.append(allocator, try entry.dir.readFileAlloc(allocator, entry.basename, std.math.maxInt(u32)));
+        }
+    }
+
+    return sources.items;
+}
+
+const SkipSpaceMode = enum{
+    scalar,
+    vector,
+};
+
+const ScanPosition = struct{
+    i: u64 = 0,
+    line: u32 = 0,
+    column: u32 = 0,
+};
+
+// Mimics the parser: skip space, then consume a token up to the next byte that can start a space run.
+// Every position the parser would observe goes into the checksum, so both modes must agree byte for byte
+fn scan_source(source: []const u8, comptime mode: SkipSpaceMode) u64 {
+    var position = ScanPosition{};
+    var checksum: u64 = 0;
+
+    while (true) {
+        switch (mode) {
+            .scalar => library.skip_space_scalar(&position, source),
+            .vector => library.skip_space(&position, source),
+        }
+
+        checksum = (checksum ^ position.i ^ (@as(u64, position.line) << 32) ^ position.column) *% library.fnv_prime;
+
+        if (position.i >= source.len) break;
+
+        position.i += 1;
+        while (position.i < source.len and !library.is_space(source[position.i], library.get_next_ch_safe(source, position.i))) {
+            position.i += 1;
+        }
+    }
+
+    return checksum;
+}
+
+fn benchmark_skip_space(allocator: Allocator, repetitions: usize) !void {
+    const sources = try collect_source_files(allocator, "lib/std");
+    var byte_count: usize = 0;
+    for (sources) |source| {
+        byte_count += source.len;
+    }
+
+    std.debug.print("\n[SKIP SPACE BENCHMARK ({} files, {} bytes, {} repetitions)]\n\n", .{sources.len, byte_count, repetitions});
+
+    var checksums: [2]u64 = undefined;
+    inline for (@typeInfo(SkipSpaceMode).Enum.fields, 0..) |field, mode_index| {
+        const mode = @field(SkipSpaceMode, field.name);
+        var checksum: u64 = 0;
+        const start = try std.time.Instant.now();
+        for (0..repetitions) |_| {
+            for (sources) |source| {
+                checksum ^= scan_source(source, mode);
+            }
+        }
+        const end = try std.time.Instant.now();
+        std.mem.doNotOptimizeAway(checksum);
+        checksums[mode_index] = checksum;
+
+        const ns = end.since(start);
+        const ms = @as(f64, @floatFromInt(ns)) / 1000_000.0;
+        const megabytes = @as(f64, @floatFromInt(byte_count * repetitions)) / (1024.0 * 1024.0);
+        std.debug.print("{s}: {d:.02} ms ({d:.02} MiB/s)\n", .{field.name, ms, megabytes / (ms / 1000.0)});
+    }
+
+    if (checksums[0] != checksums[1]) {
+        std.debug.print("Scalar and vector scanners disagree\n", .{});
+        return error.fail;
+    }
+}
+
+const relink_function_count = 2000;
+
+// Functions are defined callees first, as in the stress test
+fn write_relink_program(allocator: Allocator, source_file_path: []const u8, comment_count: usize) !void {
+    var source = std.ArrayListUnmanaged(u8){};
+    const writer = source.writer(allocator);
+
+    var function_index: usize = relink_function_count;
+    while (function_index > 0) {
+        function_index -= 1;
+        if (function_index + 1 < relink_function_count) {
+            try writer.print("fn f{} (arg: s32) s32 {{\n    return f{}(arg + 1);\n}}\n\n", .{function_index, function_index + 1});
+        } else {
+            try writer.print("fn f{} (arg: s32) s32 {{\n    return arg + 1;\n}}\n\n", .{function_index});
+        }
+    }
+
+    try writer.writeAll("fn[cc(.c)] main[export] () s32 {\n    >result = f0(0);\n    return result - result;\n}\n");
+
+    // Comments at the end of the file change the source but not a single line of code or debug information
+    for (0..comment_count) |comment_index| {
+        try writer.print("// {}\n", .{comment_index});
+    }
+
+    try std.fs.cwd().writeFile(.{
+        .sub_path = source_file_path,
+        .data = source.items,
+    });
+}
+
+// Only measures edits that leave every object unchanged, where the link itself is skipped. A change to code still links from scratch,
+// since nothing of a previous link is reused
+fn benchmark_relink(allocator: Allocator, repetitions: usize) !void {
+    const directory_path = "nat/benchmark/relink";
+    try std.fs.cwd().makePath(directory_path);
+    const source_file_path = directory_path ++ "/main.nat";
+    var sample = Sample{};
+
+    std.debug.print("\n[RELINK BENCHMARK ({} functions, {} repetitions)]\n\n", .{relink_function_count, repetitions});
+
+    var comment_count: usize = 0;
+    try write_relink_program(allocator, source_file_path, comment_count);
+    const warm_up = try measure_run(allocator, &.{ bootstrap_relative_path, "exe", "-incremental", "true", "-main_source_file", source_file_path });
+    if (warm_up.failures > 0) return error.fail;
+
+    for (0..repetitions) |_| {
+        comment_count += 1;
+        try write_relink_program(allocator, source_file_path, comment_count);
+        const run = try measure_run(allocator, &.{ bootstrap_relative_path, "exe", "-incremental", "true", "-main_source_file", source_file_path });
+        sample.add(run);
+    }
+
+    sample.print("comment_only");
+
+    if (sample.failures > 0) return error.fail;
+}
+
+const client_relative_path = "zig-out/bin/nat_client";
+const server_program_directory_path = "nat/benchmark/server_program";
+const server_module_count = 32;
+const server_functions_per_module = 100;
+
+// A main file importing many modules, so reading the sources and interning their identifiers is a visible part of a build
+fn write_server_program(allocator: Allocator) ![]const u8 {
+    try std.fs.cwd().makePath(server_program_directory_path);
+
+    for (0..server_module_count) |module_index| {
+        var source = std.ArrayListUnmanaged(u8){};
+        const writer = source.writer(allocator);
+        for (0..server_functions_per_module) |function_index| {
+            try writer.print("fn m{}_f{} (arg: s32) s32 {{\n    return arg + {};\n}}\n\n", .{module_index, function_index, function_index});
+        }
+        try writer.writeAll("fn foo() s32\n{\n    return 0;\n}\n");
+
+        const module_path = try std.fmt.allocPrint(allocator, "{s}/m{}.nat", .{server_program_directory_path, module_index});
+        try std.fs.cwd().writeFile(.{
+            .sub_path = module_path,
+            .data = source.items,
+        });
+    }
+
+    var source = std.ArrayListUnmanaged(u8){};
+    const writer = source.writer(allocator);
+    for (0..server_module_count) |module_index| {
+        try writer.print("import \"m{}.nat\";\n", .{module_index});
+    }
+    try writer.writeAll("\nfn [cc(.c)] main [export]() s32\n{\n");
+    for (0..server_module_count) |module_index| {
+        try writer.print("    >r{}: s32 = m{}.foo();\n", .{module_index, module_index});
+    }
+    try writer.print("    return r{};\n}}\n", .{server_module_count - 1});
+
+    const main_path = server_program_directory_path ++ "/main.nat";
+    try std.fs.cwd().writeFile(.{
+        .sub_path = main_path,
+        .data = source.items,
+    });
+
+    return main_path;
+}
+
+const BenchmarkServer = struct{
+    process: std.process.Child,
+    socket_path: []const u8,
+
+    fn start(allocator: Allocator, socket_path: []const u8, extra_arguments: []const []const u8) !BenchmarkServer {
+        std.fs.cwd().deleteFile(socket_path) catch {};
+
+        const argv = try std.mem.concat(allocator, []const u8, &.{ &.{ bootstrap_relative_path, "server", "-socket", socket_path }, extra_arguments });
+        var server = BenchmarkServer{
+            .process = std.process.Child.init(argv, allocator),
+            .socket_path = socket_path,
+        };
+        try server.process.spawn();
+
+        // Wait for the server to start listening
+        while (true) {
+            if (std.net.connectUnixSocket(socket_path)) |stream| {
+                stream.close();
+                break;
+            } else |_| {
+                std.time.sleep(10 * std.time.ns_per_ms);
+            }
+        }
+
+        return server;
+    }
+
+    fn stop(server: *BenchmarkServer) void {
+        _ = server.process.kill() catch {};
+    }
+};
+
+// Every server request is a forked compiler that analyzes the program and lib/std from scratch, so this measures what the server saves
+// before analysis starts (process startup, LLVM target initialization, reading sources and interning identifiers), not warm analysis
+const ServerMode = enum{
+    // A regular compiler process per build
+    cli,
+    // Forked from a server that only keeps lib/std sources resident
+    forked_server,
+    // Forked from a server that also read the program's sources and interned their identifiers ahead of time
+    forked_server_preloaded,
+};
+
+fn benchmark_server(allocator: Allocator, repetitions: usize) !void {
+    const test_names = try collectDirectoryDirEntries(allocator, standalone_directory_path);
+    try std.fs.cwd().makePath("nat/benchmark");
+
+    var source_file_paths = std.ArrayListUnmanaged([]const u8){};
+    for (test_names) |test_name| {
+        try source_file_paths.append(allocator, try std.mem.concat(allocator, u8, &.{ standalone_directory_path, "/", test_name, "/main.nat" }));
+    }
+    try source_file_paths.append(allocator, try write_server_program(allocator));
+
+    var server = try BenchmarkServer.start(allocator, "nat/benchmark/server.sock", &.{});
+    defer server.stop();
+    var preloaded_server = try BenchmarkServer.start(allocator, "nat/benchmark/server_preloaded.sock", &.{ "-preload", standalone_directory_path, "-preload", server_program_directory_path });
+    defer preloaded_server.stop();
+
+    var samples = [1]Sample{.{}} ** @typeInfo(ServerMode).Enum.fields.len;
+
+    std.debug.print("\n[SERVER LATENCY BENCHMARK ({} programs, {} repetitions)]\n\n", .{source_file_paths.items.len, repetitions});
+
+    // Interleave the modes so that frequency scaling and caches affect all of them alike. The CPU time of the server requests
+    // is spent in the server and not accounted for, so only wall time is comparable
+    for (0..repetitions) |_| {
+        for (source_file_paths.items) |source_file_path| {
+            inline for (@typeInfo(ServerMode).Enum.fields, &samples) |field, *sample| {
+                const run = switch (@field(ServerMode, field.name)) {
+                    .cli => try measure_run(allocator, &.{ bootstrap_relative_path, "exe", "-main_source_file", source_file_path }),
+                    .forked_server => try measure_run(allocator, &.{ client_relative_path, "-socket", server.socket_path, "exe", "-main_source_file", source_file_path }),
+                    .forked_server_preloaded => try measure_run(allocator, &.{ client_relative_path, "-socket", preloaded_server.socket_path, "exe", "-main_source_file", source_file_path }),
+                };
+                sample.add(run);
+            }
+        }
+    }
+
+    inline for (@typeInfo(ServerMode).Enum.fields, samples) |field, sample| {
+        sample.print(field.name);
+    }
+
+    for (samples) |sample| {
+        if (sample.failures > 0) return error.fail;
+    }
+}
+
+pub fn main() !void {
+    var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    const allocator = arena.allocator();
+
+    const arguments = try std.process.argsAlloc(allocator);
+    const benchmark_name = if (arguments.len > 1) arguments[1] else "thread_wait";
+    const repetitions = if (arguments.len > 2) try std.fmt.parseInt(usize, arguments[2], 10) else 5;
+
+    if (std.mem.eql(u8, benchmark_name, "thread_wait")) {
+        try benchmark_thread_wait(allocator, repetitions);
+    } else if (std.mem.eql(u8, benchmark_name, "skip_space")) {
+        try benchmark_skip_space(allocator, repetitions);
+    } else if (std.mem.eql(u8, benchmark_name, "relink")) {
+        try benchmark_relink(allocator, repetitions);
+    } else if (std.mem.eql(u8, benchmark_name, "server")) {
+        try benchmark_server(allocator, repetitions);
+    } else {
+        std.debug.print("Unknown benchmark: {s}\n", .{benchmark_name});
+        return error.fail;
+    }
+}
@@ -0,0 +1,53 @@
+const std = @import("std");
+
+// Thin client for `nat server`. It forwards its working directory and arguments to the server, prints what the build printed
+// and exits with the status of the build. See `command_server` in bootstrap/compiler.zig for the protocol
+pub fn main() !void {
+    var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    const allocator = arena.allocator();
+
+    const arguments = try std.process.argsAlloc(allocator);
+    var socket_path: []const u8 = "nat/server.sock";
+    var first_forwarded_argument: usize = 1;
+    if (arguments.len > 2 and std.mem.eql(u8, arguments[1], "-socket")) {
+        socket_path = arguments[2];
+        first_forwarded_argument = 3;
+    }
+
+    const forwarded_arguments = arguments[first_forwarded_argument..];
+    if (forwarded_arguments.len == 0) {
+        std.debug.print("Usage: nat_client [-socket <path>] <command> [arguments...]\n", .{});
+        std.process.exit(1);
+    }
+
+    const stream = std.net.connectUnixSocket(socket_path) catch |err| {
+        std.debug.print("Unable to connect to the compiler server at {s}: {s}\n", .{socket_path, @errorName(err)});
+        std.process.exit(1);
+    };
+    defer stream.close();
+
+    var request = std.ArrayListUnmanaged(u8){};
+    const working_directory = try std.process.getCwdAlloc(allocator);
+    try append_string(allocator, &request, working_directory);
+    try request.appendSlice(allocator, std.mem.asBytes(&@as(u32, @intCast(forwarded_arguments.len))));
+    for (forwarded_arguments) |argument| {
+        try append_string(allocator, &request, argument);
+    }
+    try stream.writeAll(request.items);
+
+    const response = try stream.reader().readAllAlloc(allocator, std.math.maxInt(u32));
+    const status_size = @sizeOf(u32);
+    if (response.len < status_size) {
+        std.debug.print("The compiler server closed the connection without reporting a status\n", .{});
+        std.process.exit(1);
+    }
+
+    try std.io.getStdOut().writeAll(response[0 .. response.len - status_size]);
+    const status = std.mem.bytesToValue(u32, response[response.len - status_size ..][0..status_size]);
+    std.process.exit(@intCast(@min(status, 255)));
+}
+
+fn append_string(allocator: std.mem.Allocator, buffer: *std.ArrayListUnmanaged(u8), string: []const u8) !void {
+    try buffer.appendSlice(allocator, std.mem.asBytes(&@as(u32, @intCast(string.len))));
+    try buffer.appendSlice(allocator, string);
+}
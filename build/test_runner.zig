@@ -53,6 +53,8 @@ fn compiler_run(allocator: Allocator, args: struct{
     compiler_path: []const u8,
     is_test: bool,
     self_hosted: bool,
+    // When set, the compilation only succeeds if the compiler printed this to stderr
+    expected_stderr: ?[]const u8 = null,
 }) !Run {
     std.debug.print("{s} [repetitions={}] {s}", .{args.test_name, args.repetitions, if (args.repetitions > 1) "\n\n" else ""});
     var run = Run{};
@@ -76,11 +78,21 @@ fn compiler_run(allocator: Allocator, args: struct{
             .Unknown => error.unknown,
         };
 
-        const compilation_success = compilation_result catch b: {
+        var compilation_success = compilation_result catch b: {
             run.compilation_failure += 1;
             break :b false;
         };
 
+        if (compilation_success) {
+            if (args.expected_stderr) |expected_stderr| {
+                if (std.mem.indexOf(u8, compile_run.stderr, expected_stderr) == null) {
+                    std.debug.print("Expected in STDERR: {s}\n", .{expected_stderr});
+                    run.compilation_failure += 1;
+                    compilation_success = false;
+                }
+            }
+        }
+
         std.debug.print("[COMPILATION {s}] ", .{if (compilation_success) "\x1b[32mOK\x1b[0m" else "\x1b[31mFAILED\x1b[0m"});
         if (compile_run.stdout.len > 0) {
             std.debug.print("STDOUT:\n\n{s}\n\n", .{compile_run.stdout});
@@ -647,10 +659,197 @@ fn c_abi_tests(allocator: Allocator) !void {
     try group_end(group, test_count, run); 
 }
 
+// Packs an object built by build.zig into a regular and a thin archive with `nat ar`, then links a program against each of them
+fn archive_tests(allocator: Allocator, member_object_path: []const u8) !void {
+    const test_count = 2;
+    const group = "ARCHIVE";
+    group_start(group, test_count);
+    var run = Run{};
+
+    for ([_]bool{ false, true }) |thin| {
+        const test_name = if (thin) "archive_thin" else "archive";
+        const archive_path = try std.mem.concat(allocator, u8, &.{ "nat/archive/lib", test_name, ".a" });
+        const archive_run = try std.process.Child.run(.{
+            .allocator = allocator,
+            .argv = &.{ bootstrap_relative_path, "ar", "-o", archive_path, "-thin", if (thin) "true" else "false", "-members", member_object_path },
+            .max_output_bytes = std.math.maxInt(u64),
+        });
+
+        const archive_success = switch (archive_run.term) {
+            .Exited => |exit_code| exit_code == 0,
+            else => false,
+        };
+
+        if (!archive_success) {
+            std.debug.print("{s} [ARCHIVE \x1b[31mFAILED\x1b[0m]\n", .{archive_path});
+            if (archive_run.stdout.len > 0) {
+                std.debug.print("STDOUT:\n\n{s}\n\n", .{archive_run.stdout});
+            }
+            if (archive_run.stderr.len > 0) {
+                std.debug.print("STDERR:\n\n{s}\n\n", .{archive_run.stderr});
+            }
+            run.compilation_run += 1;
+            run.compilation_failure += 1;
+            continue;
+        }
+
+        run.add(try compiler_run(allocator, .{
+            .test_name = test_name,
+            .repetitions = 1,
+            .extra_arguments = &.{ "-name", test_name, "-link_inputs_start", archive_path, "-link_inputs_end" },
+            .source_file_path = "retest/archive/main.nat",
+            .compiler_path = bootstrap_relative_path,
+            .is_test = false,
+            .self_hosted = false,
+        }));
+    }
+
+    try group_end(group, test_count, run);
+}
+
+const c_batch_source_directory = "nat/c_batch_sources";
+const c_batch_prefix_header_path = c_batch_source_directory ++ "/prefix.h";
+// Both are only declared by the prefix header, so the sources fail to compile unless the precompiled header is applied
+const c_batch_prefix_header =
+    \\#define C_BATCH_BASE 10
+    \\static inline int c_batch_twice(int x) { return x * 2; }
+    \\
+;
+const c_batch_sources = [_]struct{ path: []const u8, body: []const u8 }{
+    .{ .path = c_batch_source_directory ++ "/a.c", .body = "int c_batch_a(void) { return c_batch_twice(C_BATCH_BASE); }\n" },
+    .{ .path = c_batch_source_directory ++ "/b.c", .body = "int c_batch_b(void) { return C_BATCH_BASE + 5; }\n" },
+    .{ .path = c_batch_source_directory ++ "/c.c", .body = "int c_batch_c(void) { return c_batch_twice(3) + 1; }\n" },
+};
+
+// Builds a multi-file C unit in batch mode with a prefix header three times: cold, warm and after one of the files changed.
+// Every build has to run and print the C object reuse counters that match what was rewritten before it
+fn c_batch_tests(allocator: Allocator) !void {
+    const Build = struct{
+        name: []const u8,
+        rewritten_sources: []const usize,
+        expected_stderr: []const u8,
+    };
+    const builds = [_]Build{
+        .{ .name = "c_batch_cold", .rewritten_sources = &.{ 0, 1, 2 }, .expected_stderr = "C objects: 0/3 reused" },
+        .{ .name = "c_batch_warm", .rewritten_sources = &.{}, .expected_stderr = "C objects: 3/3 reused" },
+        .{ .name = "c_batch_one_changed", .rewritten_sources = &.{1}, .expected_stderr = "C objects: 2/3 reused" },
+    };
+    const test_count = builds.len;
+    const group = "C BATCH";
+    group_start(group, test_count);
+    var run = Run{};
+
+    try std.fs.cwd().makePath(c_batch_source_directory);
+    try std.fs.cwd().writeFile(.{
+        .sub_path = c_batch_prefix_header_path,
+        .data = c_batch_prefix_header,
+    });
+
+    for (builds) |build| {
+        for (build.rewritten_sources) |source_index| {
+            const source = c_batch_sources[source_index];
+            // The timestamp makes every rewrite a content change, so objects left over from an earlier run are never reused
+            try std.fs.cwd().writeFile(.{
+                .sub_path = source.path,
+                .data = try std.fmt.allocPrint(allocator, "// {}\n{s}", .{ std.time.nanoTimestamp(), source.body }),
+            });
+        }
+
+        run.add(try compiler_run(allocator, .{
+            .test_name = build.name,
+            .repetitions = 1,
+            .extra_arguments = &.{
+                "-name",                 build.name,
+                "-c_compilation",        "batch",
+                "-c_prefix_header",      c_batch_prefix_header_path,
+                "-c_source_files_start", c_batch_sources[0].path,
+                c_batch_sources[1].path, c_batch_sources[2].path,
+                "-c_source_files_end",
+            },
+            .source_file_path = "retest/c_batch/main.nat",
+            .compiler_path = bootstrap_relative_path,
+            .is_test = false,
+            .self_hosted = false,
+            .expected_stderr = build.expected_stderr,
+        }));
+    }
+
+    try group_end(group, test_count, run);
+}
+
+// Every `if`/`else` costs three basic blocks (then, else and exit), so this adds up to about a million of them
+const stress_function_count = 1000;
+const stress_ifs_per_function = 334;
+
+fn generate_basic_block_stress_program(allocator: Allocator, directory_path: []const u8) ![]const u8 {
+    try std.fs.cwd().makePath(directory_path);
+    var source = std.ArrayListUnmanaged(u8){};
+    const writer = source.writer(allocator);
+
+    // Define callees first so the program doesn't depend on out-of-order resolution
+    var function_index: usize = stress_function_count;
+    while (function_index > 0) {
+        function_index -= 1;
+        try writer.print("fn f{} (arg: s32) s32 {{\n    >result: s32 = arg;\n", .{function_index});
+
+        for (0..stress_ifs_per_function) |_| {
+            try writer.writeAll("    if (result < 0) {\n        result = result - 1;\n    } else {\n        result = result + 1;\n    }\n");
+        }
+
+        if (function_index + 1 < stress_function_count) {
+            try writer.print("    return f{}(result);\n}}\n\n", .{function_index + 1});
+        } else {
+            try writer.writeAll("    return result;\n}\n\n");
+        }
+    }
+
+    try writer.print("fn[cc(.c)] main[export] () s32 {{\n    >result = f0(0);\n    return result - {};\n}}\n", .{stress_function_count * stress_ifs_per_function});
+
+    const source_file_path = try std.mem.concat(allocator, u8, &.{ directory_path, "/main.nat" });
+    try std.fs.cwd().writeFile(.{
+        .sub_path = source_file_path,
+        .data = source.items,
+    });
+
+    return source_file_path;
+}
+
+fn stress_tests(allocator: Allocator) !void {
+    const test_count = 1;
+    const group = "STRESS";
+    group_start(group, test_count);
+    const source_file_path = try generate_basic_block_stress_program(allocator, "nat/stress/basic_blocks");
+    const run = try compiler_run(allocator, .{
+        .test_name = "basic_blocks",
+        .repetitions = 1,
+        .extra_arguments = &.{},
+        .source_file_path = source_file_path,
+        .compiler_path = bootstrap_relative_path,
+        .is_test = false,
+        .self_hosted = false,
+    });
+    try group_end(group, test_count, run);
+}
+
 pub fn main() !void {
     var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
     const allocator = arena.allocator();
 
+    // The stress group compiles about a million basic blocks, so it only runs when asked for (zig build stress)
+    const arguments = try std.process.argsAlloc(allocator);
+    var archive_member: ?[]const u8 = null;
+    var i: usize = 1;
+    while (i < arguments.len) : (i += 1) {
+        const argument = arguments[i];
+        if (std.mem.eql(u8, argument, "stress")) {
+            try stress_tests(allocator);
+            return;
+        } else if (std.mem.eql(u8, argument, "-archive_member") and i + 1 < arguments.len) {
+            i += 1;
+            archive_member = arguments[i];
+        }
+    }
+
     try runStandalone(allocator, .{
         .is_test = false,
         .compiler_path = bootstrap_relative_path,
@@ -661,6 +860,12 @@ pub fn main() !void {
     });
 
     try c_abi_tests(allocator);
+    try c_batch_tests(allocator);
+
+    // The member object is built by build.zig, so the group only runs through zig build test
+    if (archive_member) |member_object_path| {
+        try archive_tests(allocator, member_object_path);
+    }
 
     // var errors = run_test_suite(allocator, .{
     //     .self_hosted = false,
@@ -0,0 +1,4 @@
+int archive_member_value(void)
+{
+    return 42;
+}
@@ -21,6 +21,7 @@
 #include "llvm/Support/Chrono.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/ConvertUTF.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Format.h"
@@ -41,6 +42,9 @@
 #include "llvm/ToolDrivers/llvm-dlltool/DlltoolDriver.h"
 #include "llvm/ToolDrivers/llvm-lib/LibDriver.h"
 
+#include <atomic>
+#include <thread>
+
 #if !defined(_MSC_VER) && !defined(__MINGW32__)
 #include <unistd.h>
 #else
@@ -1430,10 +1434,10 @@ static int llvm_ar_main(int argc, char **argv, const llvm::ToolContext &) {
   // ZIG PATCH: On Windows, InitLLVM calls GetCommandLineW(),
   // and overwrites the args.  We don't want it to do that,
   // and we also don't need the signal handlers it installs
-  // (we have our own already), so we just use llvm_shutdown_obj
-  // instead.
+  // (we have our own already).
   // InitLLVM X(argc, argv);
-  llvm::llvm_shutdown_obj X;
+  // NATIVITY PATCH: no llvm_shutdown_obj either. This runs inside the
+  // compiler process, which keeps using LLVM after the archiver returns.
 
   ToolName = argv[0];
 
@@ -1468,3 +1472,271 @@ static int llvm_ar_main(int argc, char **argv, const llvm::ToolContext &) {
 extern "C" int NativityLLVMArchiverMain(int argc, char ** argv) {
   return llvm_ar_main(argc, argv, {argv[0], nullptr, false});
 }
+
+// Archive writer for the compiler's own use, such as packing libc.a. Unlike the ar command above, the members can be handed in
+// from memory, their symbols are read on several threads at once, and the archive is written front to back in a single streamed
+// pass instead of being assembled in memory first. Only the GNU format is written. Thin archives reference their members by
+// path instead of embedding them, which is what local caches want since the objects already live next to the archive
+
+namespace {
+struct StreamedArchiveMember
+{
+    StringRef path;
+    // Thin archives resolve member paths against the directory of the archive, not the current one
+    std::string thin_path;
+    std::string header_name;
+    MemoryBufferRef buffer;
+    std::unique_ptr<MemoryBuffer> mapped_buffer;
+    std::vector<std::string> symbols;
+    uint64_t header_offset;
+    std::string error;
+};
+}
+
+static bool archive_is_symbol(const object::BasicSymbolRef& symbol)
+{
+    Expected<uint32_t> flags = symbol.getFlags();
+    if (!flags) {
+        consumeError(flags.takeError());
+        return false;
+    }
+
+    return !(*flags & object::SymbolRef::SF_FormatSpecific) && (*flags & object::SymbolRef::SF_Global) && !(*flags & object::SymbolRef::SF_Undefined);
+}
+
+// Bitcode members need a context to be read, so every worker brings its own
+static void archive_read_member(StreamedArchiveMember& member, LLVMContext& context)
+{
+    if (!member.buffer.getBufferStart()) {
+        auto mapped_buffer = MemoryBuffer::getFile(member.path, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+        if (!mapped_buffer) {
+            member.error = member.path.str() + ": " + mapped_buffer.getError().message();
+            return;
+        }
+
+        member.mapped_buffer = std::move(*mapped_buffer);
+        member.buffer = member.mapped_buffer->getMemBufferRef();
+    }
+
+    file_magic magic = identify_magic(member.buffer.getBuffer());
+    if (!object::SymbolicFile::isSymbolicFile(magic, &context)) {
+        return;
+    }
+
+    auto symbolic_file = object::SymbolicFile::createSymbolicFile(member.buffer, magic, &context);
+    if (!symbolic_file) {
+        member.error = member.path.str() + ": " + toString(symbolic_file.takeError());
+        return;
+    }
+
+    for (auto& symbol : (*symbolic_file)->symbols()) {
+        if (!archive_is_symbol(symbol)) {
+            continue;
+        }
+
+        std::string name;
+        raw_string_ostream stream(name);
+        if (auto error = symbol.printName(stream)) {
+            member.error = member.path.str() + ": " + toString(std::move(error));
+            return;
+        }
+
+        stream.flush();
+        member.symbols.push_back(std::move(name));
+    }
+}
+
+// Deterministic header: no timestamp, owner or group
+static void archive_write_member_header(raw_ostream& out, StringRef name, StringRef mode, uint64_t size)
+{
+    out << left_justify(name, 16) << left_justify("0", 12) << left_justify("0", 6) << left_justify("0", 6) << left_justify(mode, 8) << left_justify(std::to_string(size), 10) << "`\n";
+}
+
+extern "C" void stream_to_string(raw_string_ostream& stream, const char** message_ptr, size_t* message_len);
+
+// Members are given by path. A null buffer pointer (or a null `member_buffer_ptrs`) means the member is read from that path,
+// otherwise the buffer is the member contents and the path only names it. Thin archives store every path relative to the
+// archive's directory and can't take buffers, since the member has to exist at its path
+extern "C" bool NativityLLVMArchiveWrite(const char* archive_path_ptr, size_t archive_path_len, const char* const* member_path_ptrs, const size_t* member_path_lens, const char* const* member_buffer_ptrs, const size_t* member_buffer_lens, size_t member_count, unsigned thread_count, bool thin, const char** error_ptr, size_t* error_len)
+{
+    std::string error_message;
+    raw_string_ostream error_stream(error_message);
+    auto archive_path = StringRef(archive_path_ptr, archive_path_len);
+
+    std::vector<StreamedArchiveMember> members(member_count);
+    for (size_t i = 0; i < member_count; i += 1) {
+        auto& member = members[i];
+        member.path = StringRef(member_path_ptrs[i], member_path_lens[i]);
+        if (member_buffer_ptrs && member_buffer_ptrs[i]) {
+            if (thin) {
+                error_stream << member.path << ": a thin archive member must be read from its path\n";
+                continue;
+            }
+
+            member.buffer = MemoryBufferRef(StringRef(member_buffer_ptrs[i], member_buffer_lens[i]), member.path);
+        }
+
+        if (thin) {
+            auto relative_path = computeArchiveRelativePath(archive_path, member.path);
+            if (!relative_path) {
+                error_stream << member.path << ": " << toString(relative_path.takeError()) << "\n";
+                continue;
+            }
+
+            member.thin_path = std::move(*relative_path);
+        }
+    }
+
+    if (!error_message.empty()) {
+        stream_to_string(error_stream, error_ptr, error_len);
+        return false;
+    }
+
+    // Reading symbol tables is the expensive part and every member is independent
+    thread_count = std::max(1u, std::min<unsigned>(thread_count, member_count));
+    std::atomic<size_t> next_member(0);
+    auto worker = [&]() {
+        LLVMContext context;
+        while (true) {
+            auto index = next_member.fetch_add(1);
+            if (index >= member_count) {
+                break;
+            }
+
+            archive_read_member(members[index], context);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < thread_count; i += 1) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& member : members) {
+        if (!member.error.empty()) {
+            error_stream << member.error << "\n";
+        }
+    }
+
+    if (!error_message.empty()) {
+        stream_to_string(error_stream, error_ptr, error_len);
+        return false;
+    }
+
+    // Everything is sized up front, so member offsets are known before the first byte is written
+    std::string long_names;
+    for (auto& member : members) {
+        StringRef name = thin ? StringRef(member.thin_path) : sys::path::filename(member.path);
+        if (thin || name.size() > 15 || name.contains('/')) {
+            member.header_name = "/" + std::to_string(long_names.size());
+            long_names += name;
+            long_names += "/\n";
+        } else {
+            member.header_name = (name + "/").str();
+        }
+    }
+
+    uint64_t symbol_count = 0;
+    uint64_t symbol_name_size = 0;
+    for (auto& member : members) {
+        symbol_count += member.symbols.size();
+        for (auto& symbol : member.symbols) {
+            symbol_name_size += symbol.size() + 1;
+        }
+    }
+
+    const uint64_t member_header_size = 60;
+    uint64_t symbol_table_size = symbol_count ? sizeof(uint32_t) * (1 + symbol_count) + symbol_name_size : 0;
+    uint64_t offset = 8;
+    if (symbol_table_size) {
+        offset += member_header_size + alignTo(symbol_table_size, 2);
+    }
+    if (!long_names.empty()) {
+        offset += member_header_size + alignTo(long_names.size(), 2);
+    }
+
+    for (auto& member : members) {
+        member.header_offset = offset;
+        offset += member_header_size;
+        if (!thin) {
+            offset += alignTo(member.buffer.getBufferSize(), 2);
+        }
+    }
+
+    if (symbol_table_size && offset > UINT32_MAX) {
+        error_stream << archive_path << ": archive is too large for a 32-bit symbol table\n";
+        stream_to_string(error_stream, error_ptr, error_len);
+        return false;
+    }
+
+    // Streamed to a temporary file and renamed, so readers never see a partial archive
+    auto temporary_path = (archive_path + ".tmp").str();
+    {
+        std::error_code error_code;
+        raw_fd_ostream out(temporary_path, error_code, sys::fs::OF_None);
+        if (error_code) {
+            error_stream << temporary_path << ": " << error_code.message() << "\n";
+            stream_to_string(error_stream, error_ptr, error_len);
+            return false;
+        }
+
+        out << (thin ? "!<thin>\n" : "!<arch>\n");
+
+        if (symbol_table_size) {
+            archive_write_member_header(out, "/", "0", symbol_table_size);
+            support::endian::write<uint32_t>(out, symbol_count, llvm::endianness::big);
+            for (auto& member : members) {
+                for (size_t i = 0; i < member.symbols.size(); i += 1) {
+                    support::endian::write<uint32_t>(out, member.header_offset, llvm::endianness::big);
+                }
+            }
+            for (auto& member : members) {
+                for (auto& symbol : member.symbols) {
+                    out << symbol << '\0';
+                }
+            }
+            if (symbol_table_size & 1) {
+                out << '\n';
+            }
+        }
+
+        if (!long_names.empty()) {
+            archive_write_member_header(out, "//", "", long_names.size());
+            out << long_names;
+            if (long_names.size() & 1) {
+                out << '\n';
+            }
+        }
+
+        for (auto& member : members) {
+            auto size = member.buffer.getBufferSize();
+            archive_write_member_header(out, member.header_name, "644", size);
+            if (!thin) {
+                out << member.buffer.getBuffer();
+                if (size & 1) {
+                    out << '\n';
+                }
+            }
+        }
+
+        out.close();
+        if (out.has_error()) {
+            error_stream << temporary_path << ": " << out.error().message() << "\n";
+            out.clear_error();
+            stream_to_string(error_stream, error_ptr, error_len);
+            return false;
+        }
+    }
+
+    if (auto error_code = sys::fs::rename(temporary_path, archive_path)) {
+        error_stream << archive_path << ": " << error_code.message() << "\n";
+        stream_to_string(error_stream, error_ptr, error_len);
+        return false;
+    }
+
+    return true;
+}
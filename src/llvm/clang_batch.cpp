@@ -0,0 +1,220 @@
+#include "clang/Basic/Diagnostic.h"
+#include "clang/Basic/DiagnosticOptions.h"
+#include "clang/Basic/FileManager.h"
+#include "clang/CodeGen/ObjectFilePCHContainerOperations.h"
+#include "clang/Driver/Compilation.h"
+#include "clang/Driver/Driver.h"
+#include "clang/Driver/Job.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "clang/Frontend/CompilerInvocation.h"
+#include "clang/Frontend/TextDiagnosticBuffer.h"
+#include "clang/Frontend/TextDiagnosticPrinter.h"
+#include "clang/FrontendTool/Utils.h"
+#include "clang/Tooling/DependencyScanning/DependencyScanningFilesystem.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/VirtualFileSystem.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/TargetParser/Host.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace clang;
+using namespace clang::driver;
+using namespace clang::tooling::dependencies;
+
+// Defined in clang_main.cpp
+std::string GetExecutablePath(const char *Argv0, bool CanonicalPrefixes);
+extern "C" int nat_clang_main(int argc, char ** argv);
+
+// The driver is run once per file to turn its command line into a cc1 invocation. Anything that does not
+// lower to exactly one cc1 job (assembly, multiple inputs) keeps going through the regular driver path
+struct BatchCommand
+{
+    std::vector<std::string> cc1_arguments;
+    bool in_process;
+};
+
+static BatchCommand batch_build_command(int argc, char** argv)
+{
+    BatchCommand command = {};
+    // Same layout as nat_clang_main: [executable, "clang", arguments...]
+    SmallVector<const char*, 256> arguments(argv + 1, argv + argc);
+
+    IntrusiveRefCntPtr<DiagnosticOptions> diagnostic_options = new DiagnosticOptions();
+    TextDiagnosticPrinter* diagnostic_printer = new TextDiagnosticPrinter(llvm::errs(), &*diagnostic_options);
+    IntrusiveRefCntPtr<DiagnosticIDs> diagnostic_ids(new DiagnosticIDs());
+    DiagnosticsEngine diagnostics(diagnostic_ids, &*diagnostic_options, diagnostic_printer);
+
+    auto executable_path = GetExecutablePath(argv[0], true);
+    Driver driver(executable_path, llvm::sys::getDefaultTargetTriple(), diagnostics);
+    driver.setInstalledDir(llvm::sys::path::parent_path(executable_path));
+
+    std::unique_ptr<Compilation> compilation(driver.BuildCompilation(arguments));
+    if (!compilation || compilation->containsError()) {
+        return command;
+    }
+
+    auto& jobs = compilation->getJobs();
+    if (jobs.size() != 1) {
+        return command;
+    }
+
+    auto& job = *jobs.begin();
+    auto& job_arguments = job.getArguments();
+    if (job_arguments.empty() || StringRef(job_arguments[0]) != "-cc1") {
+        return command;
+    }
+
+    for (size_t i = 1; i < job_arguments.size(); i += 1) {
+        command.cc1_arguments.push_back(job_arguments[i]);
+    }
+
+    command.in_process = true;
+    return command;
+}
+
+// -mllvm options are parsed into process-wide cl::opt storage, so invocations that carry them can't run next to each other
+static bool batch_command_has_llvm_arguments(const BatchCommand& command)
+{
+    for (auto& argument : command.cc1_arguments) {
+        if (argument == "-mllvm") {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool batch_execute_cc1(const BatchCommand& command, const char* executable, FileManager& file_manager, std::string& diagnostic_output)
+{
+    SmallVector<const char*, 256> arguments;
+    for (auto& argument : command.cc1_arguments) {
+        arguments.push_back(argument.c_str());
+    }
+
+    auto instance = std::make_unique<CompilerInstance>();
+    auto pch_operations = instance->getPCHContainerOperations();
+    pch_operations->registerWriter(std::make_unique<ObjectFilePCHContainerWriter>());
+    pch_operations->registerReader(std::make_unique<ObjectFilePCHContainerReader>());
+
+    IntrusiveRefCntPtr<DiagnosticOptions> diagnostic_options = new DiagnosticOptions();
+    TextDiagnosticBuffer* diagnostic_buffer = new TextDiagnosticBuffer;
+    IntrusiveRefCntPtr<DiagnosticIDs> diagnostic_ids(new DiagnosticIDs());
+    DiagnosticsEngine argument_diagnostics(diagnostic_ids, &*diagnostic_options, diagnostic_buffer);
+
+    bool success = CompilerInvocation::CreateFromArgs(instance->getInvocation(), arguments, argument_diagnostics, executable);
+
+    if (instance->getHeaderSearchOpts().UseBuiltinIncludes && instance->getHeaderSearchOpts().ResourceDir.empty()) {
+        instance->getHeaderSearchOpts().ResourceDir = CompilerInvocation::GetResourcesPath(executable, (void*)(intptr_t)GetExecutablePath);
+    }
+
+    // Diagnostics are buffered per file and printed as a whole, otherwise concurrent files would interleave line by line
+    llvm::raw_string_ostream diagnostic_stream(diagnostic_output);
+    instance->createDiagnostics(new TextDiagnosticPrinter(diagnostic_stream, &instance->getDiagnosticOpts()), true);
+    diagnostic_buffer->FlushDiagnostics(instance->getDiagnostics());
+
+    if (success) {
+        instance->setFileManager(&file_manager);
+        success = ExecuteCompilerInvocation(instance.get());
+    }
+
+    instance->getDiagnosticClient().finish();
+    diagnostic_stream.flush();
+
+    return success;
+}
+
+// A batch of C/C++ sources compiled in-process. Every file is lowered through the driver when the batch is created and
+// the cc1 invocations are then run one at a time by the caller's own worker threads (nat_clang_batch_compile), so
+// the batch never spins up threads of its own. All workers look up and read sources and headers through one shared
+// stat and contents cache, so the system and libc headers every file includes hit the disk once per batch instead of
+// once per file. Each worker slot keeps its FileManager across the files it compiles
+struct NatClangBatch
+{
+    char** const* argvs;
+    const int* argcs;
+    std::vector<BatchCommand> commands;
+    std::vector<IntrusiveRefCntPtr<FileManager>> file_managers;
+    DependencyScanningFilesystemSharedCache shared_cache;
+    std::mutex output_mutex;
+    bool serial;
+};
+
+// `argvs` and `argcs` must outlive the batch. `worker_count` is the number of distinct worker indices that
+// nat_clang_batch_compile is going to be called with
+extern "C" NatClangBatch* nat_clang_batch_create(char** const* argvs, const int* argcs, size_t count, unsigned worker_count)
+{
+    llvm::InitializeAllTargets();
+    llvm::InitializeAllTargetMCs();
+    llvm::InitializeAllAsmPrinters();
+    llvm::InitializeAllAsmParsers();
+
+    auto* batch = new NatClangBatch();
+    batch->argvs = argvs;
+    batch->argcs = argcs;
+    batch->commands.resize(count);
+    batch->file_managers.resize(worker_count);
+    batch->serial = false;
+
+    for (size_t i = 0; i < count; i += 1) {
+        batch->commands[i] = batch_build_command(argcs[i], argvs[i]);
+        batch->serial = batch->serial || batch_command_has_llvm_arguments(batch->commands[i]);
+    }
+
+    return batch;
+}
+
+// When this is true the caller must not run nat_clang_batch_compile for this batch on more than one thread at a time
+extern "C" bool nat_clang_batch_is_serial(const NatClangBatch* batch)
+{
+    return batch->serial;
+}
+
+// Runs the cc1 invocation of file `index`. A worker index must not be used by two threads at the same time.
+// Files that did not lower to a single cc1 job are left for nat_clang_batch_finish and report success here
+extern "C" bool nat_clang_batch_compile(NatClangBatch* batch, size_t index, unsigned worker_index)
+{
+    auto& command = batch->commands[index];
+    if (!command.in_process) {
+        return true;
+    }
+
+    auto& file_manager = batch->file_managers[worker_index];
+    if (!file_manager) {
+        IntrusiveRefCntPtr<DependencyScanningWorkerFilesystem> file_system(new DependencyScanningWorkerFilesystem(batch->shared_cache, llvm::vfs::createPhysicalFileSystem()));
+        file_manager = new FileManager(FileSystemOptions(), file_system);
+    }
+
+    std::string diagnostic_output;
+    bool success = batch_execute_cc1(command, batch->argvs[index][0], *file_manager, diagnostic_output);
+
+    if (!diagnostic_output.empty()) {
+        std::lock_guard<std::mutex> lock(batch->output_mutex);
+        llvm::errs() << diagnostic_output;
+    }
+
+    return success;
+}
+
+// Must be called once every nat_clang_batch_compile call has returned. The files that go through the regular driver
+// run here, one after the other: the driver touches process-wide state and must not overlap the in-process
+// invocations. Destroys the batch and returns the number of those files that failed to compile
+extern "C" int nat_clang_batch_finish(NatClangBatch* batch)
+{
+    int failure_count = 0;
+
+    for (size_t i = 0; i < batch->commands.size(); i += 1) {
+        if (!batch->commands[i].in_process) {
+            failure_count += nat_clang_main(batch->argcs[i], batch->argvs[i]) != 0;
+        }
+    }
+
+    delete batch;
+
+    return failure_count;
+}
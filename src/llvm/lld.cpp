@@ -1,4 +1,9 @@
 #include "lld/Common/CommonLinkerContext.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 using namespace llvm;
 
 enum class Format {
@@ -28,6 +33,9 @@ namespace lld {
 
 extern "C" void stream_to_string(raw_string_ostream& stream, const char** message_ptr, size_t* message_len);
 
+// LLD is called with exitEarly = false and its global context is destroyed after every link, so a long-lived compiler process can
+// link any number of times without LLD terminating it
+
 extern "C" bool NativityLLDLinkELF(const char** argument_ptr, size_t argument_count, const char** stdout_ptr, size_t* stdout_len, const char** stderr_ptr, size_t* stderr_len)
 {
     auto arguments = ArrayRef<const char*>(argument_ptr, argument_count);
@@ -37,7 +45,79 @@ extern "C" bool NativityLLDLinkELF(const char** argument_ptr, size_t argument_co
     std::string stderr_string;
     raw_string_ostream stderr_stream(stderr_string);
 
-    bool success = lld::elf::link(arguments, stdout_stream, stderr_stream, true, false);
+    bool success = lld::elf::link(arguments, stdout_stream, stderr_stream, false, false);
+    lld::CommonLinkerContext::destroy();
+
+    stream_to_string(stdout_stream, stdout_ptr, stdout_len);
+    stream_to_string(stderr_stream, stderr_ptr, stderr_len);
+
+    return success;
+}
+
+// Links objects that only exist in memory. LLD's ELF driver only reads inputs from paths, so every buffer is copied into an anonymous
+// in-memory file and handed over as /proc/self/fd/N. Buffer i replaces the placeholder argument at `buffer_argument_indices[i]`, so
+// in-memory objects keep their place among the other inputs
+extern "C" bool NativityLLDLinkELFBuffers(const char** argument_ptr, size_t argument_count, const size_t* buffer_argument_indices, const char* const* buffer_ptrs, const size_t* buffer_lens, size_t buffer_count, const char** stdout_ptr, size_t* stdout_len, const char** stderr_ptr, size_t* stderr_len)
+{
+    std::string stdout_string;
+    raw_string_ostream stdout_stream(stdout_string);
+
+    std::string stderr_string;
+    raw_string_ostream stderr_stream(stderr_string);
+
+    bool success = true;
+#ifdef __linux__
+    std::vector<int> file_descriptors;
+    std::vector<std::string> buffer_paths;
+
+    for (size_t i = 0; i < buffer_count; i += 1) {
+        int file_descriptor = memfd_create("nat_object", MFD_CLOEXEC);
+        if (file_descriptor < 0) {
+            stderr_stream << "memfd_create failed for object buffer " << i << "\n";
+            success = false;
+            break;
+        }
+
+        file_descriptors.push_back(file_descriptor);
+
+        const char* buffer = buffer_ptrs[i];
+        size_t remaining = buffer_lens[i];
+        while (remaining > 0) {
+            ssize_t written = write(file_descriptor, buffer, remaining);
+            if (written <= 0) {
+                stderr_stream << "Unable to write object buffer " << i << "\n";
+                success = false;
+                break;
+            }
+
+            buffer += written;
+            remaining -= written;
+        }
+
+        if (!success) {
+            break;
+        }
+
+        buffer_paths.push_back("/proc/self/fd/" + std::to_string(file_descriptor));
+    }
+
+    if (success) {
+        std::vector<const char*> arguments(argument_ptr, argument_ptr + argument_count);
+        for (size_t i = 0; i < buffer_count; i += 1) {
+            arguments[buffer_argument_indices[i]] = buffer_paths[i].c_str();
+        }
+
+        success = lld::elf::link(arguments, stdout_stream, stderr_stream, false, false);
+        lld::CommonLinkerContext::destroy();
+    }
+
+    for (int file_descriptor : file_descriptors) {
+        close(file_descriptor);
+    }
+#else
+    stderr_stream << "Linking from memory buffers is only supported on Linux\n";
+    success = false;
+#endif
 
     stream_to_string(stdout_stream, stdout_ptr, stdout_len);
     stream_to_string(stderr_stream, stderr_ptr, stderr_len);
@@ -54,7 +134,8 @@ extern "C" bool NativityLLDLinkCOFF(const char** argument_ptr, size_t argument_c
     std::string stderr_string;
     raw_string_ostream stderr_stream(stderr_string);
 
-    bool success = lld::coff::link(arguments, stdout_stream, stderr_stream, true, false);
+    bool success = lld::coff::link(arguments, stdout_stream, stderr_stream, false, false);
+    lld::CommonLinkerContext::destroy();
 
     stream_to_string(stdout_stream, stdout_ptr, stdout_len);
     stream_to_string(stderr_stream, stderr_ptr, stderr_len);
@@ -71,7 +152,8 @@ extern "C" bool NativityLLDLinkMachO(const char** argument_ptr, size_t argument_
     std::string stderr_string;
     raw_string_ostream stderr_stream(stderr_string);
 
-    bool success = lld::macho::link(arguments, stdout_stream, stderr_stream, true, false);
+    bool success = lld::macho::link(arguments, stdout_stream, stderr_stream, false, false);
+    lld::CommonLinkerContext::destroy();
 
     stream_to_string(stdout_stream, stdout_ptr, stdout_len);
     stream_to_string(stderr_stream, stderr_ptr, stderr_len);
@@ -88,7 +170,8 @@ extern "C" bool NativityLLDLinkWasm(const char** argument_ptr, size_t argument_c
     std::string stderr_string;
     raw_string_ostream stderr_stream(stderr_string);
 
-    bool success = lld::wasm::link(arguments, stdout_stream, stderr_stream, true, false);
+    bool success = lld::wasm::link(arguments, stdout_stream, stderr_stream, false, false);
+    lld::CommonLinkerContext::destroy();
 
     stream_to_string(stdout_stream, stdout_ptr, stdout_len);
     stream_to_string(stderr_stream, stderr_ptr, stderr_len);
@@ -9,6 +9,12 @@
 
 #include "llvm/Linker/Linker.h"
 
+#include "llvm/Analysis/ModuleSummaryAnalysis.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+
+
 #include "llvm/Passes/PassBuilder.h"
 
 #include "llvm/MC/TargetRegistry.h"
@@ -19,6 +25,9 @@
 
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/BLAKE3.h"
+
+#include "llvm/Transforms/Utils/SplitModule.h"
 
 
 using namespace llvm;
@@ -1001,7 +1010,7 @@ extern "C" void NativityLLVMModuleSetTargetTriple(Module& module, const char* ta
     module.setTargetTriple(target_triple);
 }
 
-extern "C" void NativityLLVMRunOptimizationPipeline(Module& module, TargetMachine& target_machine, OptimizationLevel optimization_level)
+extern "C" void NativityLLVMRunOptimizationPipeline(Module& module, TargetMachine& target_machine, OptimizationLevel optimization_level, bool thin_lto, bool lto)
 {
     // TODO: PGO
     // TODO: CS profile
@@ -1038,15 +1047,12 @@ extern "C" void NativityLLVMRunOptimizationPipeline(Module& module, TargetMachin
 
     ModulePassManager module_pass_manager;
 
-    bool thin_lto = false;
-    bool lto = false;
-
     // TODO: thin lto post-link
     // TODO: instrument
     if (thin_lto) {
-        // TODO
+        module_pass_manager = pass_builder.buildThinLTOPreLinkDefaultPipeline(optimization_level);
     } else if (lto) {
-        // TODO
+        module_pass_manager = pass_builder.buildLTOPreLinkDefaultPipeline(optimization_level);
     } else {
         module_pass_manager = pass_builder.buildPerModuleDefaultPipeline(optimization_level, lto);
     }
@@ -1077,6 +1083,110 @@ extern "C" bool NativityLLVMModuleAddPassesToEmitFile(Module& module, TargetMach
     return true;
 }
 
+// Same as above, but the object stays in memory. The buffer is owned by the caller
+extern "C" bool NativityLLVMModuleEmitToBuffer(Module& module, TargetMachine& target_machine, CodeGenFileType codegen_file_type, bool disable_verify, const char** buffer_ptr, size_t* buffer_len)
+{
+    SmallVector<char, 0> buffer;
+    raw_svector_ostream stream(buffer);
+
+    legacy::PassManager pass;
+
+    // We invert the condition because LLVM conventions are just stupid
+    if (target_machine.addPassesToEmitFile(pass, stream, nullptr, codegen_file_type, disable_verify)) {
+        return false;
+    }
+
+    pass.run(module);
+
+    char* result = new char[buffer.size()];
+    memcpy(result, buffer.data(), buffer.size());
+    *buffer_ptr = result;
+    *buffer_len = buffer.size();
+
+    return true;
+}
+
+extern "C" bool NativityLLVMModuleWriteThinLTOBitcode(Module& module, const char* bitcode_file_path_ptr, size_t bitcode_file_path_len)
+{
+    std::error_code error_code;
+    auto bitcode_file_path = StringRef(bitcode_file_path_ptr, bitcode_file_path_len);
+    raw_fd_ostream stream(bitcode_file_path, error_code, sys::fs::OF_None);
+    if (error_code) {
+        return false;
+    }
+
+    // The summary is what the linker uses to build the combined index and decide what to import across modules
+    ProfileSummaryInfo profile_summary_info(module);
+    auto summary_index = buildModuleSummaryIndex(module, nullptr, &profile_summary_info);
+    WriteBitcodeToFile(module, stream, false, &summary_index);
+    stream.flush();
+
+    return true;
+}
+
+// The module and source file names are left out: they only name the thread or partition the module was built by, and which thread
+// gets which files changes from run to run
+extern "C" void NativityLLVMModuleGetBitcodeHash(Module& module, uint8_t* hash_ptr)
+{
+    auto module_identifier = module.getModuleIdentifier();
+    auto source_file_name = module.getSourceFileName();
+    module.setModuleIdentifier("");
+    module.setSourceFileName("");
+
+    SmallVector<char, 0> buffer;
+    raw_svector_ostream stream(buffer);
+    WriteBitcodeToFile(module, stream);
+
+    module.setModuleIdentifier(module_identifier);
+    module.setSourceFileName(source_file_name);
+
+    auto hash = BLAKE3::hash<LLVM_BLAKE3_OUT_LEN>(ArrayRef<uint8_t>(reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size()));
+    memcpy(hash_ptr, hash.data(), hash.size());
+}
+
+// Partitions the module by function into `partition_count` modules. Internal symbols referenced across partitions are promoted so the objects link.
+// Every partition is round-tripped through bitcode into its own context, so the partitions can be optimized and emitted on different threads.
+// Partitions are released with NativityLLVMModuleDisposePartition
+extern "C" void NativityLLVMModuleSplit(Module& module, unsigned partition_count, Module** partitions_ptr)
+{
+    unsigned partition_index = 0;
+    SplitModule(module, partition_count, [&](std::unique_ptr<Module> partition) {
+        SmallVector<char, 0> buffer;
+        raw_svector_ostream stream(buffer);
+        WriteBitcodeToFile(*partition, stream);
+
+        auto* context = new LLVMContext();
+        auto buffer_reference = MemoryBufferRef(StringRef(buffer.data(), buffer.size()), partition->getModuleIdentifier());
+        auto result = parseBitcodeFile(buffer_reference, *context);
+        if (!result) {
+            report_fatal_error(result.takeError());
+        }
+
+        partitions_ptr[partition_index] = result->release();
+        partition_index += 1;
+    });
+
+    assert(partition_index == partition_count);
+}
+
+extern "C" unsigned NativityLLVMModuleGetDefinedFunctionCount(const Module& module)
+{
+    unsigned count = 0;
+    for (auto& function : module) {
+        count += !function.isDeclaration();
+    }
+
+    return count;
+}
+
+// Partitions own their context, so the module and the context are freed together once the partition has been emitted
+extern "C" void NativityLLVMModuleDisposePartition(Module* module)
+{
+    auto* context = &module->getContext();
+    delete module;
+    delete context;
+}
+
 extern "C" Attribute NativityLLVMContextGetAttributeFromEnum(LLVMContext& context, Attribute::AttrKind kind, uint64_t value)
 {
     static_assert(sizeof(Attribute) == sizeof(uintptr_t));